@@ -51,6 +51,7 @@ class QAPConductivity : public QuantitiesAddPhys
     //Accessors
     virtual void setGrad(const Coord &grad, int num = -1);
     virtual const Coord& getGrad(int num = -1) const { return m_gradTk[num]; };
+    virtual std::size_t getMemoryUsage() const { return sizeof(*this) + m_gradTk.capacity() * sizeof(Coord); };
 
     protected:
     std::vector<Coord> m_gradTk;                  //!< Vector of the temperature gradient of each phase of the cell
@@ -91,6 +91,8 @@ class QuantitiesAddPhys
 
     //! \brief     Return the corresponding additional-physic class of this quantities class
     AddPhys* getAddPhys() { return m_addPhys; };
+    //! \brief     Return the bytes used by the quantities object and its gradients (memory accounting)
+    virtual std::size_t getMemoryUsage() const { return sizeof(*this); };
 
     protected:
       AddPhys* m_addPhys;           //!< Corresponding additional-physic class of this quantities class
@@ -51,6 +51,7 @@ class QAPSurfaceTension : public QuantitiesAddPhys
       //Accessors
       virtual void setGrad(const Coord &grad, int num = -1);
       virtual const Coord& getGrad(int num = -1) const { return m_gradC[0]; };
+      virtual std::size_t getMemoryUsage() const { return sizeof(*this) + m_gradC.capacity() * sizeof(Coord); };
 
     protected:
     std::vector<Coord> m_gradC;           //!< Gradient of the transport function (vector w)
@@ -51,6 +51,7 @@ class QAPViscosity : public QuantitiesAddPhys
     //Accessors
     virtual void setGrad(const Coord &grad, int num = -1);                       //1:U, 2:V, 3:W
     virtual const Coord& getGrad(int num = -1) const { return m_grads[num-1]; }; //1:U, 2:V, 3:W
+    virtual std::size_t getMemoryUsage() const { return sizeof(*this) + m_grads.capacity() * sizeof(Coord); };
 
     protected:
     std::vector<Coord> m_grads;                   //!< Gradient vectors of the velocities of the cell in x-, y- and z-directions       
@@ -0,0 +1,359 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+//! \file      RegressionRunner.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include "RegressionRunner.h"
+#include "../Run.h"
+#include "../Errors.h"
+
+using namespace tinyxml2;
+
+//Phases timed by the runner (regions of the profiler, the initialization is timed apart)
+static const char* PHASES[] = { "time loop", "flux", "slopes", "relaxation", "time evolution", "AddPhys", "refinement", "balancing", "output" };
+static const int NBPHASES = sizeof(PHASES) / sizeof(PHASES[0]);
+static const char* NORMES[] = { "L1", "L2", "Linf" };
+
+//***********************************************************************
+
+RegressionRunner::RegressionRunner(XMLElement *element, const std::string &fileName) :
+  m_record(false), m_minTime(0.5)
+{
+  const char* manifest(element->Attribute("manifest"));
+  if (manifest == NULL) throw ErrorXMLAttribut("manifest", fileName, __FILE__, __LINE__);
+  m_manifest = manifest;
+  const char* mode(element->Attribute("mode"));
+  if (mode != NULL) {
+    std::string typeMode(mode);
+    Tools::uppercase(typeMode);
+    if (typeMode == "RECORD") m_record = true;
+    else if (typeMode != "COMPARE") throw ErrorXMLAttribut("mode", fileName, __FILE__, __LINE__);
+  }
+}
+
+//***********************************************************************
+
+RegressionRunner::~RegressionRunner(){}
+
+//***********************************************************************
+
+bool RegressionRunner::execute(int argc, char* argv[], int &numTestCase)
+{
+  //1) Manifest reading
+  //-------------------
+  XMLDocument xmlManifest;
+  XMLError error(xmlManifest.LoadFile(m_manifest.c_str()));
+  if (error != XML_SUCCESS) throw ErrorXML(m_manifest, __FILE__, __LINE__);
+  XMLElement *racine(xmlManifest.FirstChildElement("regression"));
+  if (racine == NULL) throw ErrorXMLRacine("regression", m_manifest, __FILE__, __LINE__);
+  XMLElement *element(racine->FirstChildElement("baselines"));
+  if (element == NULL) throw ErrorXMLElement("baselines", m_manifest, __FILE__, __LINE__);
+  const char* dossier(element->Attribute("folder"));
+  if (dossier == NULL) throw ErrorXMLAttribut("folder", m_manifest, __FILE__, __LINE__);
+  std::string folderBaselines(dossier);
+  //Default tolerances: relative slowdown of a phase and relative drift of a norm
+  double slowdown(0.25), fields(1.e-8);
+  element = racine->FirstChildElement("tolerances");
+  if (element != NULL) {
+    if (element->QueryDoubleAttribute("slowdown", &slowdown) == XML_WRONG_ATTRIBUTE_TYPE) throw ErrorXMLAttribut("slowdown", m_manifest, __FILE__, __LINE__);
+    if (element->QueryDoubleAttribute("minTime", &m_minTime) == XML_WRONG_ATTRIBUTE_TYPE) throw ErrorXMLAttribut("minTime", m_manifest, __FILE__, __LINE__);
+    if (element->QueryDoubleAttribute("fields", &fields) == XML_WRONG_ATTRIBUTE_TYPE) throw ErrorXMLAttribut("fields", m_manifest, __FILE__, __LINE__);
+  }
+
+  if (rankCpu == 0) {
+    #ifdef WIN32
+      _mkdir("./results");
+      _mkdir("./results/regression");
+      if (m_record) { _mkdir(folderBaselines.c_str()); }
+    #else
+      mkdir("./results", S_IRWXU);
+      mkdir("./results/regression", S_IRWXU);
+      if (m_record) { mkdir(folderBaselines.c_str(), S_IRWXU); }
+    #endif
+  }
+
+  //2) Loop on the test cases
+  //-------------------------
+  std::ostringstream rapport;
+  int nbCas(0), nbEchecs(0);
+  std::vector<std::string> resume;
+  for (XMLElement *cas = racine->FirstChildElement("case"); cas != NULL; cas = cas->NextSiblingElement("case")) {
+    const char* name(cas->Attribute("name"));
+    if (name == NULL) throw ErrorXMLAttribut("name", m_manifest, __FILE__, __LINE__);
+    const char* folder(cas->Attribute("folder"));
+    if (folder == NULL) throw ErrorXMLAttribut("folder", m_manifest, __FILE__, __LINE__);
+    int iterations(0);
+    cas->QueryIntAttribute("iterations", &iterations);
+    double slowdownCas(slowdown), fieldsCas(fields);
+    cas->QueryDoubleAttribute("slowdown", &slowdownCas);
+    cas->QueryDoubleAttribute("fields", &fieldsCas);
+    std::string fichierReference(folderBaselines + name + "_" + IO::toString(Ncpu) + "cpu.xml");
+
+    numTestCase++; nbCas++;
+    if (rankCpu == 0) {
+      std::cout << "           EXECUTION OF THE TEST CASE NUMBER: " << numTestCase << std::endl;
+      std::cout << "************************************************************" << std::endl;
+      std::cout << "T" << numTestCase << " | Regression test case: " << name << " (" << folder << ")" << std::endl;
+    }
+    bool succes(true);
+    Run *run(0);
+    RegressionMeasures mesures;
+    try {
+      run = new Run(folder, numTestCase);
+      double debut(MPI_Wtime());
+      run->initialize(argc, argv);
+      double tempsInitialisation(MPI_Wtime() - debut);
+      //Fixed number of iterations, results written at the end only
+      if (iterations > 0) {
+        run->m_controleIterations = true;
+        run->m_nbIte = iterations;
+        run->m_freq = iterations;
+      }
+      run->solver();
+      this->mesure(run, tempsInitialisation, mesures);
+      run->finalize();
+      delete run;
+      run = 0;
+    }
+    catch (ErrorECOGEN &e) {
+      delete run;
+      run = 0;
+      if (rankCpu == 0) {
+        std::cerr << e.infoError() << std::endl;
+        rapport << "Test case " << name << ": ERROR during the run" << std::endl << std::endl;
+      }
+      succes = false;
+    }
+    if (rankCpu == 0 && succes) {
+      rapport << "Test case " << name << " (" << mesures.m_iterations << " iterations, " << mesures.m_leafCells << " leaf cells, " << Ncpu << " CPU(s))" << std::endl;
+      if (m_record) {
+        this->ecritReference(fichierReference, name, mesures);
+        rapport << "  baseline recorded in " << fichierReference << std::endl << std::endl;
+      }
+      else { succes = this->compare(fichierReference, mesures, slowdownCas, fieldsCas, rapport); }
+    }
+    MPI_Bcast(&succes, 1, MPI_C_BOOL, 0, MPI_COMM_WORLD);
+    if (!succes) nbEchecs++;
+    resume.push_back(std::string(succes ? "  PASSED  " : "  FAILED  ") + name);
+  }
+
+  //3) Report
+  //---------
+  if (rankCpu == 0) {
+    std::ostringstream bilan;
+    bilan << "REGRESSION TESTS (" << (m_record ? "record" : "compare") << " mode, manifest " << m_manifest << ")" << std::endl;
+    for (unsigned int c = 0; c < resume.size(); c++) { bilan << resume[c] << std::endl; }
+    bilan << nbCas - nbEchecs << " / " << nbCas << " test case(s) passed" << std::endl;
+    std::ofstream fileStream("./results/regression/regressionReport.out");
+    fileStream << bilan.str() << std::endl << rapport.str();
+    fileStream.close();
+    std::cout << "************************************************************" << std::endl;
+    std::cout << rapport.str() << bilan.str();
+    std::cout << "Report written in ./results/regression/regressionReport.out" << std::endl;
+  }
+  return nbEchecs == 0;
+}
+
+//***********************************************************************
+
+void RegressionRunner::mesure(Run *run, const double &tempsInitialisation, RegressionMeasures &mesures) const
+{
+  //1) Phase times, the slowest CPU gives the wall time
+  std::vector<double> temps(NBPHASES + 1);
+  temps[0] = tempsInitialisation;
+  for (int p = 0; p < NBPHASES; p++) { temps[p + 1] = run->m_stat.getRegionTime(PHASES[p]); }
+  mesures.m_times.resize(NBPHASES + 1);
+  MPI_Allreduce(&temps[0], &mesures.m_times[0], NBPHASES + 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  mesures.m_phases.clear();
+  mesures.m_phases.push_back("initialization");
+  for (int p = 0; p < NBPHASES; p++) { mesures.m_phases.push_back(PHASES[p]); }
+  mesures.m_iterations = run->m_iteration;
+
+  //2) Names of the fields: the ones of the results files (vectors through their magnitude)
+  Cell *cellRef(cellLeft); //Reference cell of the run (a CPU may own no cell after load balancing)
+  int numberPhases(run->m_numberPhases);
+  mesures.m_fields.clear();
+  for (int k = 0; k < numberPhases; k++) {
+    for (int var = 1; var <= cellRef->getPhase(k)->getNumberScalars(); var++) { mesures.m_fields.push_back(cellRef->getPhase(k)->returnNameScalar(var) + "_" + IO::toString(k)); }
+    for (int var = 1; var <= cellRef->getPhase(k)->getNumberVectors(); var++) { mesures.m_fields.push_back(cellRef->getPhase(k)->returnNameVector(var) + "_" + IO::toString(k)); }
+  }
+  if (numberPhases > 1) {
+    for (int var = 1; var <= cellRef->getMixture()->getNumberScalars(); var++) { mesures.m_fields.push_back(cellRef->getMixture()->returnNameScalar(var)); }
+    for (int var = 1; var <= cellRef->getMixture()->getNumberVectors(); var++) { mesures.m_fields.push_back(cellRef->getMixture()->returnNameVector(var)); }
+  }
+  for (int t = 0; t < run->m_numberTransports; t++) { mesures.m_fields.push_back(run->m_nameGTR[t]); }
+  int nbFields(mesures.m_fields.size());
+
+  //3) Volume weighted norms over the leaf cells
+  //Sums: volume, then sum(|v|*vol) and sum(v*v*vol) for each field, then the number of leaf cells
+  std::vector<double> sommes(1 + 2 * nbFields + 1, 0.), maxima(nbFields, 0.);
+  std::vector<double> valeurs(nbFields);
+  for (int lvl = 0; lvl <= run->m_lvlMax; lvl++) {
+    for (unsigned int i = 0; i < run->m_cellsLvl[lvl].size(); i++) {
+      Cell *cell(run->m_cellsLvl[lvl][i]);
+      if (cell->getSplit()) continue;
+      int f(0);
+      for (int k = 0; k < numberPhases; k++) {
+        for (int var = 1; var <= cell->getPhase(k)->getNumberScalars(); var++) { valeurs[f++] = cell->getPhase(k)->returnScalar(var); }
+        for (int var = 1; var <= cell->getPhase(k)->getNumberVectors(); var++) { valeurs[f++] = cell->getPhase(k)->returnVector(var).norm(); }
+      }
+      if (numberPhases > 1) {
+        for (int var = 1; var <= cell->getMixture()->getNumberScalars(); var++) { valeurs[f++] = cell->getMixture()->returnScalar(var); }
+        for (int var = 1; var <= cell->getMixture()->getNumberVectors(); var++) { valeurs[f++] = cell->getMixture()->returnVector(var).norm(); }
+      }
+      for (int t = 0; t < run->m_numberTransports; t++) { valeurs[f++] = cell->getTransport(t).getValue(); }
+      double volume(cell->getElement()->getVolume());
+      sommes[0] += volume;
+      for (f = 0; f < nbFields; f++) {
+        sommes[1 + f] += std::fabs(valeurs[f]) * volume;
+        sommes[1 + nbFields + f] += valeurs[f] * valeurs[f] * volume;
+        maxima[f] = std::max(maxima[f], std::fabs(valeurs[f]));
+      }
+      sommes[1 + 2 * nbFields] += 1.;
+    }
+  }
+  std::vector<double> sommesGlobales(sommes.size()), maximaGlobaux(nbFields);
+  MPI_Allreduce(&sommes[0], &sommesGlobales[0], sommes.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  if (nbFields > 0) MPI_Allreduce(&maxima[0], &maximaGlobaux[0], nbFields, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  mesures.m_norms.resize(3 * nbFields);
+  double volumeTotal(std::max(sommesGlobales[0], 1.e-300));
+  for (int f = 0; f < nbFields; f++) {
+    mesures.m_norms[3 * f] = sommesGlobales[1 + f] / volumeTotal;
+    mesures.m_norms[3 * f + 1] = std::sqrt(sommesGlobales[1 + nbFields + f] / volumeTotal);
+    mesures.m_norms[3 * f + 2] = maximaGlobaux[f];
+  }
+  mesures.m_leafCells = static_cast<long long>(sommesGlobales[1 + 2 * nbFields] + 0.5);
+}
+
+//***********************************************************************
+
+void RegressionRunner::ecritReference(const std::string &fichier, const std::string &nameCase, const RegressionMeasures &mesures) const
+{
+  std::ofstream fileStream(fichier.c_str());
+  if (!fileStream) throw ErrorECOGEN("impossible to write baseline file: " + fichier, __FILE__, __LINE__);
+  fileStream << std::setprecision(17);
+  fileStream << "<?xml version = \"1.0\" encoding = \"UTF-8\" standalone = \"yes\"?>" << std::endl;
+  fileStream << "<baseline case=\"" << nameCase << "\" ranks=\"" << Ncpu << "\" iterations=\"" << mesures.m_iterations << "\" leafCells=\"" << mesures.m_leafCells << "\">" << std::endl;
+  for (unsigned int p = 0; p < mesures.m_phases.size(); p++) {
+    fileStream << "  <phase name=\"" << mesures.m_phases[p] << "\" time=\"" << mesures.m_times[p] << "\"/>" << std::endl;
+  }
+  for (unsigned int f = 0; f < mesures.m_fields.size(); f++) {
+    fileStream << "  <field name=\"" << mesures.m_fields[f] << "\"";
+    for (int n = 0; n < 3; n++) { fileStream << " " << NORMES[n] << "=\"" << mesures.m_norms[3 * f + n] << "\""; }
+    fileStream << "/>" << std::endl;
+  }
+  fileStream << "</baseline>" << std::endl;
+  fileStream.close();
+}
+
+//***********************************************************************
+
+bool RegressionRunner::compare(const std::string &fichier, const RegressionMeasures &mesures, const double &slowdown, const double &fields, std::ostringstream &rapport) const
+{
+  XMLDocument xmlReference;
+  if (xmlReference.LoadFile(fichier.c_str()) != XML_SUCCESS) {
+    rapport << "  no baseline " << fichier << " (record it with mode=\"record\")" << std::endl << std::endl;
+    return false;
+  }
+  XMLElement *racine(xmlReference.FirstChildElement("baseline"));
+  if (racine == NULL) {
+    rapport << "  unreadable baseline " << fichier << std::endl << std::endl;
+    return false;
+  }
+  bool succes(true);
+  rapport << std::scientific << std::setprecision(3);
+
+  //1) Number of iterations and of leaf cells (AMR drift)
+  int iterations(0); long long leafCells(0);
+  racine->QueryIntAttribute("iterations", &iterations);
+  const char* cellules(racine->Attribute("leafCells"));
+  if (cellules != NULL) { std::istringstream lecture(cellules); lecture >> leafCells; }
+  if (iterations != mesures.m_iterations || leafCells != mesures.m_leafCells) {
+    rapport << "  FAILED: " << mesures.m_iterations << " iterations and " << mesures.m_leafCells << " leaf cells, baseline " << iterations << " and " << leafCells << std::endl;
+    succes = false;
+  }
+
+  //2) Phase times
+  rapport << "  Phase                  baseline (s)   current (s)      ratio" << std::endl;
+  for (unsigned int p = 0; p < mesures.m_phases.size(); p++) {
+    double reference(-1.);
+    for (XMLElement *phase = racine->FirstChildElement("phase"); phase != NULL; phase = phase->NextSiblingElement("phase")) {
+      const char* name(phase->Attribute("name"));
+      if (name != NULL && mesures.m_phases[p] == name) { phase->QueryDoubleAttribute("time", &reference); break; }
+    }
+    if (reference < 0.) continue;
+    double ratio(reference > 0. ? mesures.m_times[p] / reference : 0.);
+    bool lent(reference >= m_minTime && mesures.m_times[p] > reference * (1. + slowdown));
+    rapport << "  " << std::left << std::setw(22) << mesures.m_phases[p] << std::right << std::setw(13) << reference << std::setw(14) << mesures.m_times[p]
+      << std::fixed << std::setprecision(2) << std::setw(11) << ratio << std::scientific << std::setprecision(3) << (lent ? "  SLOWER" : "") << std::endl;
+    if (lent) succes = false;
+  }
+
+  //3) Field norms, relative to the baseline norm (or to the field maximum for vanishing norms)
+  double driftMax(0.);
+  std::string fieldDriftMax;
+  for (unsigned int f = 0; f < mesures.m_fields.size(); f++) {
+    XMLElement *field(racine->FirstChildElement("field"));
+    for (; field != NULL; field = field->NextSiblingElement("field")) {
+      const char* name(field->Attribute("name"));
+      if (name != NULL && mesures.m_fields[f] == name) break;
+    }
+    if (field == NULL) {
+      rapport << "  FAILED: field " << mesures.m_fields[f] << " absent from the baseline" << std::endl;
+      succes = false;
+      continue;
+    }
+    double reference[3] = { 0., 0., 0. };
+    for (int n = 0; n < 3; n++) { field->QueryDoubleAttribute(NORMES[n], &reference[n]); }
+    for (int n = 0; n < 3; n++) {
+      double echelle(std::max(std::fabs(reference[n]), std::fabs(reference[2])));
+      double drift(std::fabs(mesures.m_norms[3 * f + n] - reference[n]));
+      if (echelle > 0.) drift /= echelle;
+      if (drift > driftMax) { driftMax = drift; fieldDriftMax = mesures.m_fields[f] + " " + NORMES[n]; }
+      if (drift > fields) {
+        rapport << "  FAILED: " << NORMES[n] << " norm of " << mesures.m_fields[f] << " = " << mesures.m_norms[3 * f + n] << ", baseline " << reference[n]
+          << " (relative drift " << drift << " > " << fields << ")" << std::endl;
+        succes = false;
+      }
+    }
+  }
+  rapport << "  Maximal relative drift of the field norms: " << driftMax << (fieldDriftMax != "" ? " (" + fieldDriftMax + ")" : "") << std::endl;
+  rapport << "  " << (succes ? "PASSED" : "FAILED") << std::endl << std::endl;
+  rapport.unsetf(std::ios_base::floatfield);
+  return succes;
+}
+
+//***********************************************************************
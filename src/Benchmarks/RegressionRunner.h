@@ -0,0 +1,93 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef REGRESSIONRUNNER_H
+#define REGRESSIONRUNNER_H
+
+//! \file      RegressionRunner.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include "../libTierces/tinyxml2.h"
+
+class Run;
+
+//! \brief     Figures of a test case run compared to its baseline
+struct RegressionMeasures
+{
+  std::vector<std::string> m_phases;      //!<Names of the timed phases
+  std::vector<double> m_times;            //!<Wall time of each phase (s, max over CPUs)
+  std::vector<std::string> m_fields;      //!<Names of the final fields
+  std::vector<double> m_norms;            //!<L1, L2 and Linf norms (volume weighted) of each field
+  long long m_leafCells;                  //!<Number of leaf cells at the end of the run
+  int m_iterations;                       //!<Number of time iterations done
+};
+
+//! \class     RegressionRunner
+//! \brief     Performance and numerical regression tests over a manifest of reference test cases
+//! \details   Each test case of the manifest is run for its number of iterations, then the wall time of the main
+//!            phases and the norms of the final fields are either recorded as the baseline of the test case (mode record)
+//!            or compared to it (mode compare): a phase slower than its baseline beyond the slowdown tolerance or a
+//!            norm drifting beyond the fields tolerance makes the test case fail.
+class RegressionRunner
+{
+  public:
+    //! \brief     Runner constructor from a XML format reading
+    //! \details   Reading data from ECOGEN.xml under the following format:
+    //!            ex: <regression manifest="./libTests/regression/manifest.xml" mode="compare"/>
+    //! \param     element          XML element to read
+    //! \param     fileName         string name of readed XML file
+    RegressionRunner(tinyxml2::XMLElement *element, const std::string &fileName);
+    ~RegressionRunner();
+
+    //! \brief     Run every test case of the manifest and record or compare its figures (collective)
+    //! \param     numTestCase      number of the last executed test case, incremented for each test case run
+    //! \return    true if every test case passed (always true in record mode)
+    bool execute(int argc, char* argv[], int &numTestCase);
+
+  private:
+    //! \brief     Measure the phase times and the final field norms of a finished run (collective)
+    void mesure(Run *run, const double &tempsInitialisation, RegressionMeasures &mesures) const;
+    //! \brief     Write the baseline file of a test case (CPU 0)
+    void ecritReference(const std::string &fichier, const std::string &nameCase, const RegressionMeasures &mesures) const;
+    //! \brief     Compare the measures to the baseline file of a test case, fill the report lines (CPU 0)
+    //! \return    true if the test case passed
+    bool compare(const std::string &fichier, const RegressionMeasures &mesures, const double &slowdown, const double &fields, std::ostringstream &rapport) const;
+
+    std::string m_manifest;        //!<Manifest file listing the test cases and the tolerances
+    bool m_record;                 //!<Record the baselines instead of comparing to them
+    double m_minTime;              //!<Phases shorter than this in the baseline are not checked for slowdowns (s)
+};
+
+#endif // REGRESSIONRUNNER_H
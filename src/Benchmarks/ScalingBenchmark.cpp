@@ -0,0 +1,424 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+//! \file      ScalingBenchmark.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include "ScalingBenchmark.h"
+#include "../Run.h"
+#include "../Errors.h"
+
+using namespace tinyxml2;
+
+//***********************************************************************
+
+ScalingBenchmark::ScalingBenchmark(XMLElement *element, const std::string &fileName, const int &numTest) :
+  m_weak(false), m_dimension(2), m_iterations(100), m_lvlMax(2), m_numberCellsRequested(0), m_numTest(numTest)
+{
+  XMLError error;
+  //Mesh type
+  const char* mesh(element->Attribute("mesh"));
+  if (mesh == NULL) throw ErrorXMLAttribut("mesh", fileName, __FILE__, __LINE__);
+  m_typeMesh = mesh;
+  Tools::uppercase(m_typeMesh);
+  if (m_typeMesh != "CARTESIAN" && m_typeMesh != "AMR" && m_typeMesh != "UNSTRUCTURED") throw ErrorXMLAttribut("mesh", fileName, __FILE__, __LINE__);
+  //Problem size
+  double numberCells(0.);
+  error = element->QueryDoubleAttribute("cells", &numberCells);
+  if (error != XML_NO_ERROR || numberCells < 1.) throw ErrorXMLAttribut("cells", fileName, __FILE__, __LINE__);
+  m_numberCellsRequested = static_cast<long long>(numberCells);
+  //Scaling type
+  const char* scaling(element->Attribute("scaling"));
+  if (scaling != NULL) {
+    std::string typeScaling(scaling);
+    Tools::uppercase(typeScaling);
+    if (typeScaling == "WEAK") m_weak = true;
+    else if (typeScaling != "STRONG") throw ErrorXMLAttribut("scaling", fileName, __FILE__, __LINE__);
+  }
+  //Optional attributes
+  if (element->QueryIntAttribute("dimension", &m_dimension) != XML_NO_ERROR) m_dimension = 2;
+  if (m_dimension != 2 && m_dimension != 3) throw ErrorXMLAttribut("dimension", fileName, __FILE__, __LINE__);
+  if (m_typeMesh == "UNSTRUCTURED" && m_dimension != 2) throw ErrorXMLAttribut("dimension", fileName, __FILE__, __LINE__);
+  if (element->QueryIntAttribute("iterations", &m_iterations) != XML_NO_ERROR) m_iterations = 100;
+  if (m_iterations < 1) throw ErrorXMLAttribut("iterations", fileName, __FILE__, __LINE__);
+  if (element->QueryIntAttribute("lvlMax", &m_lvlMax) != XML_NO_ERROR) m_lvlMax = 2;
+  if (m_lvlMax < 0) throw ErrorXMLAttribut("lvlMax", fileName, __FILE__, __LINE__);
+
+  //Base mesh: same number of cells in each direction, at least one slice of cells per CPU along x
+  double numberCellsTotal(static_cast<double>(m_numberCellsRequested));
+  if (m_weak) numberCellsTotal *= Ncpu;
+  int n(static_cast<int>(std::pow(numberCellsTotal, 1. / m_dimension) + 0.5));
+  n = std::max(n, std::max(2, Ncpu));
+  m_numberCells[0] = n; m_numberCells[1] = n; m_numberCells[2] = (m_dimension == 3 ? n : 1);
+
+  //Names of the generated test case
+  std::string typeMeshLower(m_typeMesh);
+  for (unsigned int c = 0; c < typeMeshLower.size(); c++) { typeMeshLower[c] = tolower(typeMeshLower[c]); }
+  m_name = "scaling_" + typeMeshLower + "_" + IO::toString(m_dimension) + "D_" + IO::toString(m_numberCellsRequested) + (m_weak ? "PerCpu_" : "_") + IO::toString(Ncpu) + "cpu";
+  m_folderCase = "./results/scalingCases/" + m_name + "/";
+  m_nameMesh = "scalingBenchmark/" + m_name + ".msh";
+}
+
+//***********************************************************************
+
+ScalingBenchmark::~ScalingBenchmark(){}
+
+//***********************************************************************
+
+void ScalingBenchmark::execute(int argc, char* argv[])
+{
+  //1) Generation of the problem instance
+  //-------------------------------------
+  if (rankCpu == 0) {
+    #ifdef WIN32
+      _mkdir("./results");
+      _mkdir("./results/scalingCases");
+      _mkdir(m_folderCase.c_str());
+      if (m_typeMesh == "UNSTRUCTURED") { _mkdir("./libMeshes/scalingBenchmark"); }
+    #else
+      mkdir("./results", S_IRWXU);
+      mkdir("./results/scalingCases", S_IRWXU);
+      mkdir(m_folderCase.c_str(), S_IRWXU);
+      if (m_typeMesh == "UNSTRUCTURED") { mkdir("./libMeshes/scalingBenchmark", S_IRWXU); }
+    #endif
+    this->ecritCas();
+    std::cout << "T" << m_numTest << " | Scaling benchmark: " << m_name << " (" << m_numberCells[0] << "x" << m_numberCells[1] << "x" << m_numberCells[2] << " base cells, "
+      << m_iterations << " iterations)" << std::endl;
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+  //Each CPU writes its own partition: no pretreatment of a global mesh file is needed
+  if (m_typeMesh == "UNSTRUCTURED") { this->ecritMaillageNonStructure(); }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  //2) Execution of the test case
+  //-----------------------------
+  Run *run(0);
+  try {
+    run = new Run(m_folderCase, m_numTest);
+    run->initialize(argc, argv);
+    run->solver();
+    this->ecritRapport(run);
+    run->finalize();
+    delete run;
+  }
+  catch (ErrorECOGEN &) {
+    if (run) { run->finalize(); delete run; }
+    throw;
+  }
+}
+
+//***********************************************************************
+
+void ScalingBenchmark::ecritCas() const
+{
+  //Main file
+  std::ofstream fileStream((m_folderCase + "mainV5.xml").c_str());
+  fileStream << "<?xml version = \"1.0\" encoding = \"UTF-8\" standalone = \"yes\"?>" << std::endl;
+  fileStream << "<computationParam>" << std::endl;
+  fileStream << "  <run>" << m_name << "</run>" << std::endl;
+  fileStream << "  <outputMode format=\"XML\" binary=\"true\" appended=\"true\"/>" << std::endl;
+  fileStream << "  <timeControlMode iterations=\"true\">" << std::endl;
+  fileStream << "    <iterations number=\"" << m_iterations << "\" iterFreq=\"" << m_iterations << "\"/>" << std::endl;
+  fileStream << "    <physicalTime totalTime=\"1.\" timeFreq=\"1.\"/>" << std::endl;
+  fileStream << "  </timeControlMode>" << std::endl;
+  fileStream << "  <computationControl CFL=\"0.8\"/>" << std::endl;
+  fileStream << "  <secondOrder>" << std::endl;
+  fileStream << "    <globalLimiter>mc</globalLimiter>" << std::endl;
+  fileStream << "  </secondOrder>" << std::endl;
+  fileStream << "</computationParam>" << std::endl;
+  fileStream.close();
+
+  //Mesh file
+  fileStream.open((m_folderCase + "meshV5.xml").c_str());
+  fileStream << "<?xml version = \"1.0\" encoding = \"UTF-8\" standalone = \"yes\"?>" << std::endl;
+  fileStream << "<mesh>" << std::endl;
+  if (m_typeMesh == "UNSTRUCTURED") {
+    fileStream << "  <type structure=\"unStructured\"/>" << std::endl;
+    fileStream << "  <unstructuredMesh>" << std::endl;
+    fileStream << "    <file name=\"" << m_nameMesh << "\"/>" << std::endl;
+    fileStream << "    <parallel GMSHPretraitement=\"false\"/>" << std::endl;
+    fileStream << "  </unstructuredMesh>" << std::endl;
+  }
+  else {
+    fileStream << "  <type structure=\"cartesian\"/>" << std::endl;
+    fileStream << "  <cartesianMesh>" << std::endl;
+    fileStream << "    <dimensions x=\"1.\" y=\"1.\" z=\"" << (m_dimension == 3 ? 1. : 1. / m_numberCells[0]) << "\"/>" << std::endl;
+    fileStream << "    <numberCells x=\"" << m_numberCells[0] << "\" y=\"" << m_numberCells[1] << "\" z=\"" << m_numberCells[2] << "\"/>" << std::endl;
+    if (m_typeMesh == "AMR") {
+      fileStream << "    <AMR lvlMax=\"" << m_lvlMax << "\" criteriaVar=\"0.2\" varRho=\"true\" varP=\"true\" varU=\"false\" varAlpha=\"true\" xiSplit=\"0.11\" xiJoin=\"0.11\"/>" << std::endl;
+    }
+    fileStream << "  </cartesianMesh>" << std::endl;
+  }
+  fileStream << "</mesh>" << std::endl;
+  fileStream.close();
+
+  //Model file
+  fileStream.open((m_folderCase + "modelV4.xml").c_str());
+  fileStream << "<?xml version = \"1.0\" encoding = \"UTF-8\" standalone = \"yes\"?>" << std::endl;
+  fileStream << "<model>" << std::endl;
+  fileStream << "  <flowModel name=\"Kapila\" numberPhases=\"2\" alphaNull=\"false\"/>" << std::endl;
+  fileStream << "  <EOS name=\"IG_air.xml\"/>" << std::endl;
+  fileStream << "  <EOS name=\"SG_water.xml\"/>" << std::endl;
+  fileStream << "</model>" << std::endl;
+  fileStream.close();
+
+  //Initial conditions file: air pressure wave travelling toward a water disc (sphere in 3D)
+  fileStream.open((m_folderCase + "initialConditionsV4.xml").c_str());
+  fileStream << "<?xml version = \"1.0\" encoding = \"UTF-8\" standalone = \"yes\"?>" << std::endl;
+  fileStream << "<CI>" << std::endl;
+  fileStream << "  <physicalDomains>" << std::endl;
+  fileStream << "    <domain name=\"base\" state=\"air\" type=\"entireDomain\"/>" << std::endl;
+  fileStream << "    <domain name=\"HP\" state=\"airHP\" type=\"halfSpace\">" << std::endl;
+  fileStream << "      <dataHalfSpace axe=\"x\" origin=\"0.25\" direction=\"negative\"/>" << std::endl;
+  fileStream << "    </domain>" << std::endl;
+  if (m_dimension == 3) {
+    fileStream << "    <domain name=\"droplet\" state=\"water\" type=\"sphere\">" << std::endl;
+    fileStream << "      <dataSphere radius=\"0.2\">" << std::endl;
+    fileStream << "        <center x=\"0.5\" y=\"0.5\" z=\"0.5\"/>" << std::endl;
+    fileStream << "      </dataSphere>" << std::endl;
+  }
+  else {
+    fileStream << "    <domain name=\"droplet\" state=\"water\" type=\"disc\">" << std::endl;
+    fileStream << "      <dataDisc axe1=\"x\" axe2=\"y\" radius=\"0.2\">" << std::endl;
+    fileStream << "        <center x=\"0.5\" y=\"0.5\" z=\"0.\"/>" << std::endl;
+    fileStream << "      </dataDisc>" << std::endl;
+  }
+  fileStream << "    </domain>" << std::endl;
+  fileStream << "  </physicalDomains>" << std::endl;
+  fileStream << "  <boundaryConditions>" << std::endl;
+  const char* nomsLimites[6] = { "CLXm", "CLXp", "CLYm", "CLYp", "CLZm", "CLZp" };
+  for (int l = 0; l < 2 * m_dimension; l++) {
+    fileStream << "    <boundCond name=\"" << nomsLimites[l] << "\" type=\"abs\" number=\"" << l + 1 << "\"/>" << std::endl;
+  }
+  fileStream << "  </boundaryConditions>" << std::endl;
+  const char* nomsEtats[3] = { "air", "airHP", "water" };
+  const double alphaAir[3] = { 0.999999, 0.999999, 0.000001 };
+  const double rhoAir[3] = { 1.2, 6., 1.2 };
+  const double pressure[3] = { 1.e5, 1.e6, 1.e5 };
+  for (int s = 0; s < 3; s++) {
+    fileStream << "  <state name=\"" << nomsEtats[s] << "\">" << std::endl;
+    fileStream << "    <material type=\"fluide\" EOS=\"IG_air.xml\">" << std::endl;
+    fileStream << "      <dataFluid alpha=\"" << alphaAir[s] << "\" density=\"" << rhoAir[s] << "\"/>" << std::endl;
+    fileStream << "    </material>" << std::endl;
+    fileStream << "    <material type=\"fluide\" EOS=\"SG_water.xml\">" << std::endl;
+    fileStream << "      <dataFluid alpha=\"" << 1. - alphaAir[s] << "\" density=\"1000.\"/>" << std::endl;
+    fileStream << "    </material>" << std::endl;
+    fileStream << "    <mixture>" << std::endl;
+    fileStream << "      <dataMix pressure=\"" << pressure[s] << "\"/>" << std::endl;
+    fileStream << "      <velocity x=\"0.\" y=\"0.\" z=\"0.\"/>" << std::endl;
+    fileStream << "    </mixture>" << std::endl;
+    fileStream << "  </state>" << std::endl;
+  }
+  fileStream << "</CI>" << std::endl;
+  fileStream.close();
+}
+
+//***********************************************************************
+
+void ScalingBenchmark::ecritMaillageNonStructure() const
+{
+  //Unit square of nx*ny quadrangles, CPU p owns the columns [p*nx/Ncpu, (p+1)*nx/Ncpu[
+  //Owned quadrangles and ghost ones are both listed column by column, so that the elements sent by
+  //a CPU and the ghosts received by its neighbour are in the same order.
+  const int nx(m_numberCells[0]), ny(m_numberCells[1]);
+  std::vector<int> debutColonnes(Ncpu + 1);
+  for (int p = 0; p <= Ncpu; p++) { debutColonnes[p] = static_cast<int>(static_cast<long long>(p) * nx / Ncpu); }
+  int iDebut(0), iFin(nx), iDebutFantomes(0), iFinFantomes(nx);
+  if (Ncpu > 1) {
+    iDebut = debutColonnes[rankCpu]; iFin = debutColonnes[rankCpu + 1];
+    iDebutFantomes = std::max(iDebut - 1, 0); iFinFantomes = std::min(iFin + 1, nx);
+  }
+  //CPU owning a column of quadrangles
+  int cpuColonne(0);
+  std::vector<int> cpuDeColonne(nx);
+  for (int i = 0; i < nx; i++) {
+    while (i >= debutColonnes[cpuColonne + 1]) cpuColonne++;
+    cpuDeColonne[i] = (Ncpu > 1 ? cpuColonne : 0);
+  }
+
+  //1) Local nodes: the ones of the owned quadrangles first, then the ghost ones
+  std::vector<int> numeroLocal((nx + 1) * (ny + 1), -1);
+  std::vector<int> noeuds;
+  for (int i = iDebut; i <= iFin; i++) {
+    for (int j = 0; j <= ny; j++) { numeroLocal[i * (ny + 1) + j] = noeuds.size(); noeuds.push_back(i * (ny + 1) + j); }
+  }
+  int numberNoeudsInternes(noeuds.size());
+  for (int i = iDebutFantomes; i <= iFinFantomes; i++) {
+    for (int j = 0; j <= ny; j++) {
+      if (numeroLocal[i * (ny + 1) + j] < 0) { numeroLocal[i * (ny + 1) + j] = noeuds.size(); noeuds.push_back(i * (ny + 1) + j); }
+    }
+  }
+
+  std::string fichierMesh("./libMeshes/" + m_nameMesh);
+  if (Ncpu > 1) { fichierMesh.resize(fichierMesh.size() - 4); fichierMesh += "_CPU" + IO::toString(rankCpu) + ".msh"; }
+  std::ofstream fileStream(fichierMesh.c_str());
+  if (!fileStream) throw ErrorECOGEN("impossible to write mesh file: " + fichierMesh, __FILE__, __LINE__);
+  fileStream << std::setprecision(17);
+  fileStream << "$MeshFormat" << std::endl;
+  fileStream << "2.2 0 8" << std::endl;
+  fileStream << "$EndMeshFormat" << std::endl;
+  fileStream << "$Nodes" << std::endl;
+  fileStream << noeuds.size() << std::endl;
+  for (unsigned int n = 0; n < noeuds.size(); n++) {
+    int i(noeuds[n] / (ny + 1)), j(noeuds[n] % (ny + 1));
+    fileStream << n + 1 << " " << static_cast<double>(i) / nx << " " << static_cast<double>(j) / ny << " 0" << std::endl;
+  }
+  fileStream << "$EndNodes" << std::endl;
+
+  //2) Elements: boundary segments of the owned columns, owned quadrangles, then ghost quadrangles
+  std::ostringstream elements;
+  int numberElements(0), numberFacesCommunicantes(0);
+  //Boundary segments (physical entity: 1 x-, 2 x+, 3 y-, 4 y+)
+  std::string tagsCPU(Ncpu > 1 ? " 4" : " 2");
+  std::string appartenance(Ncpu > 1 ? " 1 " + IO::toString(rankCpu + 1) : "");
+  if (iDebut == 0) {
+    for (int j = 0; j < ny; j++) { elements << ++numberElements << " 1" << tagsCPU << " 1 1" << appartenance << " " << numeroLocal[j] + 1 << " " << numeroLocal[j + 1] + 1 << std::endl; }
+  }
+  if (iFin == nx) {
+    for (int j = 0; j < ny; j++) { elements << ++numberElements << " 1" << tagsCPU << " 2 2" << appartenance << " " << numeroLocal[nx * (ny + 1) + j] + 1 << " " << numeroLocal[nx * (ny + 1) + j + 1] + 1 << std::endl; }
+  }
+  for (int i = iDebut; i < iFin; i++) {
+    elements << ++numberElements << " 1" << tagsCPU << " 3 3" << appartenance << " " << numeroLocal[i * (ny + 1)] + 1 << " " << numeroLocal[(i + 1) * (ny + 1)] + 1 << std::endl;
+    elements << ++numberElements << " 1" << tagsCPU << " 4 4" << appartenance << " " << numeroLocal[i * (ny + 1) + ny] + 1 << " " << numeroLocal[(i + 1) * (ny + 1) + ny] + 1 << std::endl;
+  }
+  //Quadrangles (physical entity 10), tagged with their CPU and the neighbouring CPUs they are ghosts of
+  std::vector<int> colonnes;
+  for (int i = iDebut; i < iFin; i++) { colonnes.push_back(i); }
+  if (iDebutFantomes < iDebut) { colonnes.push_back(iDebutFantomes); numberFacesCommunicantes += ny; }
+  if (iFinFantomes > iFin) { colonnes.push_back(iFin); numberFacesCommunicantes += ny; }
+  for (unsigned int c = 0; c < colonnes.size(); c++) {
+    int i(colonnes[c]);
+    std::ostringstream tags;
+    if (Ncpu > 1) {
+      std::vector<int> autresCPU;
+      if (i > 0 && cpuDeColonne[i - 1] != cpuDeColonne[i]) autresCPU.push_back(cpuDeColonne[i - 1]);
+      if (i < nx - 1 && cpuDeColonne[i + 1] != cpuDeColonne[i]) autresCPU.push_back(cpuDeColonne[i + 1]);
+      tags << " " << 4 + autresCPU.size() << " 10 10 " << autresCPU.size() + 1 << " " << cpuDeColonne[i] + 1;
+      for (unsigned int a = 0; a < autresCPU.size(); a++) { tags << " " << -(autresCPU[a] + 1); }
+    }
+    else { tags << " 2 10 10"; }
+    for (int j = 0; j < ny; j++) {
+      elements << ++numberElements << " 3" << tags.str() << " " << numeroLocal[i * (ny + 1) + j] + 1 << " " << numeroLocal[(i + 1) * (ny + 1) + j] + 1
+        << " " << numeroLocal[(i + 1) * (ny + 1) + j + 1] + 1 << " " << numeroLocal[i * (ny + 1) + j + 1] + 1 << std::endl;
+    }
+  }
+  fileStream << "$Elements" << std::endl;
+  fileStream << numberElements << std::endl;
+  fileStream << elements.str();
+  fileStream << "$EndElements" << std::endl;
+  if (Ncpu > 1) {
+    fileStream << "Info non lue par Gmsh : number de faces communicante" << std::endl;
+    fileStream << numberFacesCommunicantes << std::endl;
+    fileStream << "Info non lue par Gmsh : number de noeuds internes (hors fantomes)" << std::endl;
+    fileStream << numberNoeudsInternes << std::endl;
+  }
+  fileStream.close();
+}
+
+//***********************************************************************
+
+void ScalingBenchmark::ecritRapport(Run *run) const
+{
+  //Figures of the CPU
+  const int NVALEURS(7);
+  double valeurs[NVALEURS];
+  long long cellulesFeuilles(0);
+  for (int lvl = 0; lvl <= run->m_lvlMax; lvl++) {
+    for (unsigned int i = 0; i < run->m_cellsLvl[lvl].size(); i++) { if (!run->m_cellsLvl[lvl][i]->getSplit()) cellulesFeuilles++; }
+  }
+  valeurs[0] = static_cast<double>(cellulesFeuilles);
+  valeurs[1] = static_cast<double>(run->m_cellUpdates);
+  valeurs[2] = run->m_stat.getRegionTime("time loop");
+  valeurs[3] = run->m_stat.getCommunicationTime();
+  valeurs[4] = run->m_stat.getRegionTime("refinement") + run->m_stat.getRegionTime("balancing");
+  valeurs[5] = run->m_stat.getRegionTime("output");
+  valeurs[6] = static_cast<double>(Tools::peakMemory());
+  std::vector<double> valeursCPU(rankCpu == 0 ? NVALEURS * Ncpu : 1);
+  MPI_Gather(valeurs, NVALEURS, MPI_DOUBLE, &valeursCPU[0], NVALEURS, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  if (rankCpu != 0) return;
+
+  //Global figures: the wall time is the one of the slowest CPU
+  double tempsMur(0.), tempsComm(0.), tempsAMR(0.), tempsSorties(0.), memoireMax(0.), cellulesTotal(0.), misesAJour(0.);
+  for (int p = 0; p < Ncpu; p++) {
+    const double *v(&valeursCPU[NVALEURS * p]);
+    cellulesTotal += v[0]; misesAJour += v[1];
+    tempsMur = std::max(tempsMur, v[2]);
+    tempsComm += v[3]; tempsAMR = std::max(tempsAMR, v[4]); tempsSorties = std::max(tempsSorties, v[5]);
+    memoireMax = std::max(memoireMax, v[6]);
+  }
+  double tempsCalculCumule(0.);
+  for (int p = 0; p < Ncpu; p++) { tempsCalculCumule += valeursCPU[NVALEURS * p + 2]; }
+  double fractionComm(tempsCalculCumule > 0. ? tempsComm / tempsCalculCumule : 0.);
+  double cellulesParSeconde(tempsMur > 0. ? misesAJour / tempsMur : 0.);
+
+  std::string fichier(run->m_outPut->getFolderOutput() + "scaling.json");
+  std::ofstream fileStream(fichier.c_str());
+  fileStream << std::setprecision(9);
+  fileStream << "{" << std::endl;
+  fileStream << "  \"name\": \"" << m_name << "\"," << std::endl;
+  fileStream << "  \"mesh\": \"" << (m_typeMesh == "CARTESIAN" ? "cartesian" : (m_typeMesh == "AMR" ? "amr" : "unstructured")) << "\"," << std::endl;
+  fileStream << "  \"scaling\": \"" << (m_weak ? "weak" : "strong") << "\"," << std::endl;
+  fileStream << "  \"dimension\": " << m_dimension << "," << std::endl;
+  fileStream << "  \"ranks\": " << Ncpu << "," << std::endl;
+  fileStream << "  \"requestedCells\": " << m_numberCellsRequested << "," << std::endl;
+  fileStream << "  \"baseCells\": [" << m_numberCells[0] << ", " << m_numberCells[1] << ", " << m_numberCells[2] << "]," << std::endl;
+  fileStream << "  \"lvlMax\": " << run->m_lvlMax << "," << std::endl;
+  fileStream << "  \"iterations\": " << run->m_iteration << "," << std::endl;
+  fileStream << "  \"leafCells\": " << static_cast<long long>(cellulesTotal) << "," << std::endl;
+  fileStream << "  \"wallTime\": " << tempsMur << "," << std::endl;
+  fileStream << "  \"cellUpdates\": " << static_cast<long long>(misesAJour) << "," << std::endl;
+  fileStream << "  \"cellsPerSecond\": " << cellulesParSeconde << "," << std::endl;
+  fileStream << "  \"cellsPerSecondPerRank\": " << cellulesParSeconde / Ncpu << "," << std::endl;
+  fileStream << "  \"communicationFraction\": " << fractionComm << "," << std::endl;
+  fileStream << "  \"amrTime\": " << tempsAMR << "," << std::endl;
+  fileStream << "  \"outputTime\": " << tempsSorties << "," << std::endl;
+  fileStream << "  \"peakMemoryBytes\": " << static_cast<long long>(memoireMax) << "," << std::endl;
+  fileStream << "  \"perRank\": [" << std::endl;
+  for (int p = 0; p < Ncpu; p++) {
+    const double *v(&valeursCPU[NVALEURS * p]);
+    fileStream << "    {\"rank\": " << p << ", \"leafCells\": " << static_cast<long long>(v[0]) << ", \"cellUpdates\": " << static_cast<long long>(v[1])
+      << ", \"timeLoop\": " << v[2] << ", \"communicationTime\": " << v[3] << ", \"amrTime\": " << v[4] << ", \"outputTime\": " << v[5]
+      << ", \"peakMemoryBytes\": " << static_cast<long long>(v[6]) << "}" << (p < Ncpu - 1 ? "," : "") << std::endl;
+  }
+  fileStream << "  ]" << std::endl;
+  fileStream << "}" << std::endl;
+  fileStream.close();
+
+  std::cout << "T" << m_numTest << " | Scaling benchmark " << m_name << ": " << cellulesParSeconde << " cells/s on " << Ncpu << " CPU(s), wall time " << tempsMur
+    << " s, communications " << 100. * fractionComm << "%, peak memory " << memoireMax / 1048576. << " MB" << std::endl;
+  std::cout << "T" << m_numTest << " | Report written in " << fichier << std::endl;
+}
+
+//***********************************************************************
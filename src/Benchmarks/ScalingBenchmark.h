@@ -0,0 +1,87 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef SCALINGBENCHMARK_H
+#define SCALINGBENCHMARK_H
+
+//! \file      ScalingBenchmark.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include <string>
+#include "../libTierces/tinyxml2.h"
+
+class Run;
+
+//! \class     ScalingBenchmark
+//! \brief     Strong/weak scaling benchmark on a generated problem instance
+//! \details   The instance is a 2D/3D Kapila water bubble (or sphere) hit by an air pressure wave, on a Cartesian, AMR or
+//!            unstructured (quadrangles, partitioned in slices along x by each CPU) mesh of the requested size.
+//!            The input files are generated in ./results/scalingCases/ (./libMeshes/scalingBenchmark/ for the meshes),
+//!            the test case is run for a fixed number of iterations and the scaling figures of each CPU are written
+//!            in the file scaling.json of the results folder.
+class ScalingBenchmark
+{
+  public:
+    //! \brief     Benchmark constructor from a XML format reading
+    //! \details   Reading data from ECOGEN.xml under the following format:
+    //!            ex: <scalingBenchmark mesh="amr" cells="1000000" scaling="weak" dimension="2" iterations="100" lvlMax="2"/>
+    //! \param     element          XML element to read
+    //! \param     fileName         string name of readed XML file
+    //! \param     numTest          number of the test case
+    ScalingBenchmark(tinyxml2::XMLElement *element, const std::string &fileName, const int &numTest);
+    ~ScalingBenchmark();
+
+    //! \brief     Generate the instance, run it and write the scaling report (collective)
+    void execute(int argc, char* argv[]);
+
+  private:
+    //! \brief     Write the input files of the test case (CPU 0)
+    void ecritCas() const;
+    //! \brief     Write the Gmsh mesh file partition of the CPU (whole mesh on a single CPU)
+    void ecritMaillageNonStructure() const;
+    //! \brief     Gather the figures of every CPU and write scaling.json (collective)
+    void ecritRapport(Run *run) const;
+
+    std::string m_typeMesh;        //!<CARTESIAN, AMR or UNSTRUCTURED
+    bool m_weak;                   //!<Weak scaling: requested cells per CPU, else total requested cells
+    int m_dimension;               //!<Dimension of the instance (2 or 3)
+    int m_iterations;              //!<Number of time iterations
+    int m_lvlMax;                  //!<Maximum AMR level (AMR mesh only)
+    long long m_numberCellsRequested; //!<Requested number of cells (total or per CPU)
+    int m_numberCells[3];          //!<Number of base cells in each direction
+    int m_numTest;                 //!<Number of the test case
+    std::string m_name;            //!<Name of the generated test case (also name of the results folder)
+    std::string m_folderCase;      //!<Folder of the generated input files
+    std::string m_nameMesh;        //!<Name of the generated unstructured mesh (relative to ./libMeshes/)
+};
+
+#endif // SCALINGBENCHMARK_H
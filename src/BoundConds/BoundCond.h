@@ -68,7 +68,7 @@ class BoundCond : public CellInterface
     virtual const int& getNumPhys() const { return m_numPhysique; };
 
     //Pour methode AMR
-    virtual void computeXi(const double &criteriaVar, const bool &varRho, const bool &varP, const bool &varU, const bool &varAlpha) {};
+    virtual void computeXi(const double &criteriaVar, const bool &varRho, const bool &varP, const bool &varU, const bool &varAlpha, const std::vector<CriterionAMR*> &criteria) {};
     virtual void computeFluxXi();
     virtual void raffineCellInterfaceExterne(const int &nbCellsY, const int &nbCellsZ, const double &dXParent, const double &dYParent, const double &dZParent, Cell *cellRef, const int &dim);
     virtual void deraffineCellInterfaceExterne(Cell *cellRef);
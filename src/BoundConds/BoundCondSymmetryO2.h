@@ -49,6 +49,7 @@ public:
   virtual void creeLimite(TypeMeshContainer<CellInterface *> &cellInterfaces);
 
   virtual int whoAmI() const { return 6; };
+  virtual bool isWall() const { return false; };
 
   //Pour methode AMR
   virtual void creerCellInterfaceChild();  /*!< Creer un child cell interface (non initialize) */
@@ -36,18 +36,18 @@
 
 //****************************************************************************
 
-BoundCondWall::BoundCondWall() {}
+BoundCondWall::BoundCondWall() : m_symmetry(false) {}
 
 //****************************************************************************
 
-BoundCondWall::BoundCondWall(const BoundCondWall& Source, const int lvl) : BoundCond(Source)
+BoundCondWall::BoundCondWall(const BoundCondWall& Source, const int lvl) : BoundCond(Source), m_symmetry(Source.m_symmetry)
 {
   m_lvl = lvl;
 }
 
 //****************************************************************************
 
-BoundCondWall::BoundCondWall(int numPhysique) : BoundCond(numPhysique)
+BoundCondWall::BoundCondWall(int numPhysique, bool symmetry) : BoundCond(numPhysique), m_symmetry(symmetry)
 {}
 
 //****************************************************************************
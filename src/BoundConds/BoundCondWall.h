@@ -43,7 +43,7 @@ class BoundCondWall : public BoundCond
 public:
   BoundCondWall();
   BoundCondWall(const BoundCondWall& Source, const int lvl = 0); //Constructeur de copie (utile pour AMR)
-  BoundCondWall(int numPhysique);
+  BoundCondWall(int numPhysique, bool symmetry = false); //symmetry : condition de symetrie ordre 1 traitee comme une paroi
   virtual ~BoundCondWall();
 
   virtual void creeLimite(TypeMeshContainer<CellInterface *> &cellInterfaces);
@@ -51,11 +51,13 @@ public:
   virtual void solveRiemannTransportLimite(Cell &cellLeft, const int &numberTransports) const;
 
   virtual int whoAmI() const { return 2; };
+  virtual bool isWall() const { return !m_symmetry; };
 
   //Pour methode AMR
   virtual void creerCellInterfaceChild();  /*!< Creer un child cell interface (non initialize) */
 
 protected:
+  bool m_symmetry; //!< Vrai pour une condition de symetrie ordre 1 construite comme une paroi
 private:
 };
 
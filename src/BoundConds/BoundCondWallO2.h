@@ -57,6 +57,7 @@ public:
   virtual Phase* getSlopesPhase(const int &phaseNumber) const;
   virtual Mixture* getSlopesMixture() const;
   virtual Transport* getSlopesTransport(const int &numberTransport) const;
+  virtual void computeMemory(std::vector<double> &octets) const;
 
   //Pour methode AMR
   virtual void creerCellInterfaceChild();  /*!< Creer un child cell interface (non initialize) */
@@ -0,0 +1,166 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      Diagnostics.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "Diagnostics.h"
+#include "../Parallel/Parallel.h"
+#include <limits>
+#include <iomanip>
+
+using namespace tinyxml2;
+
+//***********************************************************************
+
+Diagnostics::Diagnostics(XMLElement *element, std::string fileName) : m_numberSums(0), m_numberPhases(1), m_freq(1), m_sampling(false)
+{
+  XMLError error(element->QueryIntAttribute("freq", &m_freq));
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || m_freq < 1) throw ErrorXMLAttribut("freq", fileName, __FILE__, __LINE__);
+
+  XMLElement *sousElement(element->FirstChildElement("monitor"));
+  if (sousElement == NULL) throw ErrorXMLElement("monitor", fileName, __FILE__, __LINE__);
+  while (sousElement != NULL) {
+    const char *type(sousElement->Attribute("type"));
+    if (type == NULL) throw ErrorXMLAttribut("type", fileName, __FILE__, __LINE__);
+    std::string typeMonitor(type);
+    Tools::uppercase(typeMonitor);
+    if (typeMonitor == "MASS") { m_monitors.push_back(new MonitorMass()); }
+    else if (typeMonitor == "PMAX") { m_monitors.push_back(new MonitorPMax()); }
+    else if (typeMonitor == "PMAXWALL") { m_monitors.push_back(new MonitorPMaxWall()); }
+    else if (typeMonitor == "KINETICENERGY") { m_monitors.push_back(new MonitorKineticEnergy()); }
+    else if (typeMonitor == "INTERFACEAREA") { m_monitors.push_back(new MonitorInterfaceArea(sousElement, fileName)); }
+    else if (typeMonitor == "MIXEDCELLS") { m_monitors.push_back(new MonitorMixedCells(sousElement, fileName)); }
+    else { throw ErrorXMLDev(fileName, __FILE__, __LINE__); }
+    sousElement = sousElement->NextSiblingElement("monitor");
+  }
+}
+
+//***********************************************************************
+
+Diagnostics::~Diagnostics()
+{
+  for (unsigned int m = 0; m < m_monitors.size(); m++) { delete m_monitors[m]; }
+}
+
+//***********************************************************************
+
+void Diagnostics::initialize(const int &numberPhases, const int &lvlMax, const std::string &folderOutput, const bool &restart)
+{
+  m_numberPhases = numberPhases;
+  m_substeps.assign(lvlMax + 1, 0);
+
+  //Sums first, then maxima (4 values each) for the fused reduction
+  m_offsets.resize(m_monitors.size());
+  m_numberSums = 0;
+  for (unsigned int m = 0; m < m_monitors.size(); m++) {
+    m_monitors[m]->initialize(numberPhases);
+    if (!m_monitors[m]->isMaximum()) { m_offsets[m] = m_numberSums; m_numberSums += m_monitors[m]->getNumberValues(numberPhases); }
+  }
+  int numberValues(m_numberSums);
+  for (unsigned int m = 0; m < m_monitors.size(); m++) {
+    if (m_monitors[m]->isMaximum()) { m_offsets[m] = numberValues; numberValues += 4*m_monitors[m]->getNumberValues(numberPhases); }
+  }
+  m_values.resize(numberValues);
+
+  m_fileName = folderOutput + "diagnostics.out";
+  if (rankCpu == 0 && !restart) {
+    std::ofstream fileStream(m_fileName.c_str());
+    int column(3);
+    fileStream << "#1:time 2:iteration";
+    for (unsigned int m = 0; m < m_monitors.size(); m++) {
+      for (int v = 0; v < m_monitors[m]->getNumberValues(numberPhases); v++) {
+        std::string name(m_monitors[m]->getName(v));
+        fileStream << " " << column << ":" << name;
+        if (m_monitors[m]->isMaximum()) {
+          fileStream << " " << column + 1 << ":" << name << "_x " << column + 2 << ":" << name << "_y " << column + 3 << ":" << name << "_z";
+          column += 3;
+        }
+        column++;
+      }
+    }
+    fileStream << std::endl;
+  }
+}
+
+//***********************************************************************
+
+void Diagnostics::startStep(const int &iteration)
+{
+  m_sampling = (iteration % m_freq == 0);
+  if (!m_sampling) return;
+  for (int i = 0; i < m_numberSums; i++) { m_values[i] = 0.; }
+  for (unsigned int i = m_numberSums; i < m_values.size(); i += 4) {
+    m_values[i] = std::numeric_limits<double>::lowest();
+    m_values[i + 1] = 0.; m_values[i + 2] = 0.; m_values[i + 3] = 0.;
+  }
+  for (unsigned int lvl = 0; lvl < m_substeps.size(); lvl++) { m_substeps[lvl] = 0; }
+}
+
+//***********************************************************************
+
+bool Diagnostics::accumulateLevel(const int &lvl)
+{
+  if (!m_sampling) return false;
+  return (++m_substeps[lvl] == (1 << lvl));
+}
+
+//***********************************************************************
+
+void Diagnostics::accumulate(Cell *cell)
+{
+  for (unsigned int m = 0; m < m_monitors.size(); m++) { m_monitors[m]->accumulate(cell, m_numberPhases, &m_values[m_offsets[m]]); }
+}
+
+//***********************************************************************
+
+void Diagnostics::accumulateLeafCells(const std::vector<Cell *> &cells)
+{
+  for (unsigned int i = 0; i < cells.size(); i++) { if (!cells[i]->getSplit()) { this->accumulate(cells[i]); } }
+}
+
+//***********************************************************************
+
+void Diagnostics::write(const double &time, const int &iteration)
+{
+  if (Ncpu > 1) { parallel.reduceMonitors(m_values, m_numberSums); }
+  if (rankCpu != 0) return;
+  std::ofstream fileStream(m_fileName.c_str(), std::ios::app);
+  fileStream << std::setprecision(12) << time << " " << iteration;
+  for (unsigned int m = 0; m < m_monitors.size(); m++) {
+    int numberValues(m_monitors[m]->getNumberValues(m_numberPhases));
+    if (m_monitors[m]->isMaximum()) numberValues *= 4;
+    for (int v = 0; v < numberValues; v++) { fileStream << " " << m_values[m_offsets[m] + v]; }
+  }
+  fileStream << std::endl;
+}
+
+//***********************************************************************
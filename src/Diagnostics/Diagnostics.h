@@ -0,0 +1,96 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+//! \file      Diagnostics.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "HeaderMonitors.h"
+
+//! \class     Diagnostics
+//! \brief     Global monitors computed in situ and written as a time series
+//! \details   On a sampled iteration, every leaf cell is accumulated once, in the relaxation sweep of the last substep of
+//!            its level (in a dedicated sweep for single phase models). The monitors of all CPUs are then reduced in one
+//!            fused collective and CPU 0 appends a line to the file diagnostics.out of the results folder.
+class Diagnostics
+{
+  public:
+    //! \brief     Diagnostics constructor from a XML format reading
+    //! \details   Reading data from XML file under the following format:
+    //!            ex: <diagnostics freq="10">                          <!-- sampling every freq iterations (1 by default) -->
+    //!                  <monitor type="mass"/>                       <!-- mass of each phase -->
+    //!                  <monitor type="pMax"/>                       <!-- maximum pressure and its location -->
+    //!                  <monitor type="pMaxWall"/>                   <!-- maximum pressure in the cells along walls and its location -->
+    //!                  <monitor type="kineticEnergy"/>
+    //!                  <monitor type="interfaceArea" phase="0"/>    <!-- integral of |grad alpha_phase| -->
+    //!                  <monitor type="mixedCells" epsilon="1.e-3"/> <!-- cells without a phase above 1-epsilon -->
+    //!                </diagnostics>
+    //! \param     element          XML element of the diagnostics
+    //! \param     fileName         string name of readed XML file
+    Diagnostics(tinyxml2::XMLElement *element, std::string fileName);
+    ~Diagnostics();
+
+    //! \brief     Check the monitors against the model, lay out their values and prepare the time series file
+    //! \param     numberPhases     number of phases
+    //! \param     lvlMax           maximal AMR level
+    //! \param     folderOutput     results folder of the run
+    //! \param     restart          true to append to the time series of the restarted run
+    void initialize(const int &numberPhases, const int &lvlMax, const std::string &folderOutput, const bool &restart);
+    //! \brief     Reset the monitors at the beginning of a time step if the iteration reached at its end is sampled
+    void startStep(const int &iteration);
+    //! \brief     Count an advancement of the level and tell whether its leaf cells must be accumulated
+    //! \details   True for the last substep of the level (2^lvl advancements per time step) of a sampled iteration
+    bool accumulateLevel(const int &lvl);
+    //! \brief     Add the contribution of a leaf cell to every monitor
+    void accumulate(Cell *cell);
+    //! \brief     Add the contribution of the leaf cells of a vector to every monitor
+    void accumulateLeafCells(const std::vector<Cell *> &cells);
+    //! \brief     Reduce the monitors of all CPUs and append them to the time series (collective)
+    void write(const double &time, const int &iteration);
+
+    //Accessors
+    const bool &isSampling() const { return m_sampling; };
+
+  private:
+    std::vector<Monitor *> m_monitors;   //!< Monitors in declaration order (order of the columns)
+    std::vector<int> m_offsets;          //!< Index in m_values of the first value of each monitor
+    std::vector<double> m_values;        //!< Sums then maxima stored as (value, x, y, z)
+    int m_numberSums;                    //!< Number of values reduced by a sum
+    int m_numberPhases;                  //!< Number of phases
+    int m_freq;                          //!< Sampling frequency in iterations
+    bool m_sampling;                     //!< Current time step is sampled
+    std::vector<int> m_substeps;         //!< Advancements of each level since the beginning of the time step
+    std::string m_fileName;              //!< Time series file (written by CPU 0)
+};
+
+#endif // DIAGNOSTICS_H
@@ -0,0 +1,73 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      Monitor.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "Monitor.h"
+
+//***********************************************************************
+
+Monitor::Monitor(){}
+
+//***********************************************************************
+
+Monitor::~Monitor(){}
+
+//***********************************************************************
+
+const double& Monitor::pressure(Cell *cell, const int &numberPhases)
+{
+  if (numberPhases == 1) { return cell->getPhase(0)->getPressure(); }
+  return cell->getMixture()->getPressure();
+}
+
+//***********************************************************************
+
+const double& Monitor::density(Cell *cell, const int &numberPhases)
+{
+  if (numberPhases == 1) { return cell->getPhase(0)->getDensity(); }
+  return cell->getMixture()->getDensity();
+}
+
+//***********************************************************************
+
+void Monitor::updateMaximum(const double &value, Cell *cell, double *values)
+{
+  if (value > values[0]) {
+    values[0] = value;
+    values[1] = cell->getPosition().getX();
+    values[2] = cell->getPosition().getY();
+    values[3] = cell->getPosition().getZ();
+  }
+}
+
+//***********************************************************************
@@ -0,0 +1,78 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MONITOR_H
+#define MONITOR_H
+
+//! \file      Monitor.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include <string>
+#include "../libTierces/tinyxml2.h"
+#include "../Errors.h"
+#include "../Tools.h"
+#include "../Order1/Cell.h"
+
+//! \class     Monitor
+//! \brief     Abstract class for the global quantities followed by the diagnostics
+//! \details   A monitor is either a sum over the leaf cells or a maximum carrying its location (value, x, y, z).
+//!            Its values are accumulated cell by cell during the relaxation sweep of the sampled iterations.
+class Monitor
+{
+  public:
+    Monitor();
+    virtual ~Monitor();
+
+    //! \brief     Check the monitor against the flow model
+    //! \param     numberPhases   number of phases
+    virtual void initialize(const int &numberPhases) {};
+    //! \brief     Number of values of the monitor (columns of the time series, location excluded)
+    virtual int getNumberValues(const int &numberPhases) const { return 1; };
+    //! \brief     Column name of a value of the monitor
+    virtual std::string getName(const int &numValue) const = 0;
+    //! \brief     True for a maximum carrying its location, false for a sum
+    virtual bool isMaximum() const { return false; };
+    //! \brief     Add the contribution of a leaf cell
+    //! \param     cell           leaf cell
+    //! \param     numberPhases   number of phases
+    //! \param     values         first value of the monitor (sums) or of its (value, x, y, z) groups (maxima)
+    virtual void accumulate(Cell *cell, const int &numberPhases, double *values) const = 0;
+
+  protected:
+    //! \brief     Pressure of the cell whatever the model (mixture pressure or pressure of the single phase)
+    static const double& pressure(Cell *cell, const int &numberPhases);
+    //! \brief     Density of the cell whatever the model (mixture density or density of the single phase)
+    static const double& density(Cell *cell, const int &numberPhases);
+    //! \brief     Update a (value, x, y, z) maximum group with the value of a cell
+    static void updateMaximum(const double &value, Cell *cell, double *values);
+};
+
+#endif // MONITOR_H
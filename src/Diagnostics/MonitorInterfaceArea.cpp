@@ -0,0 +1,85 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      MonitorInterfaceArea.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "MonitorInterfaceArea.h"
+
+using namespace tinyxml2;
+
+//***********************************************************************
+
+MonitorInterfaceArea::MonitorInterfaceArea() : m_numPhase(0) {}
+
+//***********************************************************************
+
+MonitorInterfaceArea::MonitorInterfaceArea(XMLElement *element, std::string fileName) : m_numPhase(0)
+{
+  XMLError error(element->QueryIntAttribute("phase", &m_numPhase));
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || m_numPhase < 0) throw ErrorXMLAttribut("phase", fileName, __FILE__, __LINE__);
+}
+
+//***********************************************************************
+
+MonitorInterfaceArea::~MonitorInterfaceArea(){}
+
+//***********************************************************************
+
+void MonitorInterfaceArea::initialize(const int &numberPhases)
+{
+  if (numberPhases == 1) throw ErrorECOGEN("monitor interfaceArea not available for a single phase model", __FILE__, __LINE__);
+  if (m_numPhase >= numberPhases) throw ErrorECOGEN("monitor interfaceArea: phase " + std::to_string(m_numPhase) + " does not exist", __FILE__, __LINE__);
+}
+
+//***********************************************************************
+
+std::string MonitorInterfaceArea::getName(const int &numValue) const
+{
+  return "interfaceAreaPhase" + std::to_string(m_numPhase);
+}
+
+//***********************************************************************
+
+void MonitorInterfaceArea::accumulate(Cell *cell, const int &numberPhases, double *values) const
+{
+  const double &alpha(cell->getPhase(m_numPhase)->getAlpha());
+  for (int b = 0; b < cell->getCellInterfacesSize(); b++) {
+    CellInterface *cellInterface(cell->getCellInterface(b));
+    //Boundaries and split faces (their children faces are in the list) are skipped
+    if (cellInterface->whoAmI() != 0 || cellInterface->getSplit()) continue;
+    Cell *neighbour(cellInterface->getCellGauche());
+    if (neighbour == cell) neighbour = cellInterface->getCellDroite();
+    values[0] += 0.5*cellInterface->getFace()->getSurface()*std::fabs(neighbour->getPhase(m_numPhase)->getAlpha() - alpha);
+  }
+}
+
+//***********************************************************************
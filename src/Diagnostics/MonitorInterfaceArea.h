@@ -0,0 +1,63 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MONITORINTERFACEAREA_H
+#define MONITORINTERFACEAREA_H
+
+//! \file      MonitorInterfaceArea.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "Monitor.h"
+
+//! \class     MonitorInterfaceArea
+//! \brief     Interface area of a phase estimated by the integral of |grad alpha_k|
+//! \details   Each face between two leaf cells contributes surface*|jump of alpha_k|, half of it being added by each
+//!            cell. Neighbours are taken as they are during the sweep (halo and coarser cells of the previous substep).
+class MonitorInterfaceArea : public Monitor
+{
+  public:
+    MonitorInterfaceArea();
+    //! \brief     Interface area monitor constructor from a XML format reading
+    //! \details   ex: <monitor type="interfaceArea" phase="0"/>  (phase number, 0 by default)
+    //! \param     element          XML element of the monitor
+    //! \param     fileName         string name of readed XML file
+    MonitorInterfaceArea(tinyxml2::XMLElement *element, std::string fileName);
+    virtual ~MonitorInterfaceArea();
+
+    virtual void initialize(const int &numberPhases);
+    virtual std::string getName(const int &numValue) const;
+    virtual void accumulate(Cell *cell, const int &numberPhases, double *values) const;
+
+  private:
+    int m_numPhase;   //!< Phase number whose volume fraction defines the interface
+};
+
+#endif // MONITORINTERFACEAREA_H
@@ -0,0 +1,52 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MONITORKINETICENERGY_H
+#define MONITORKINETICENERGY_H
+
+//! \file      MonitorKineticEnergy.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "Monitor.h"
+
+//! \class     MonitorKineticEnergy
+//! \brief     Kinetic energy of the flow (sum of 0.5 rho u^2 V over the leaf cells)
+class MonitorKineticEnergy : public Monitor
+{
+  public:
+    MonitorKineticEnergy();
+    virtual ~MonitorKineticEnergy();
+
+    virtual std::string getName(const int &numValue) const { return "kineticEnergy"; };
+    virtual void accumulate(Cell *cell, const int &numberPhases, double *values) const;
+};
+
+#endif // MONITORKINETICENERGY_H
@@ -0,0 +1,63 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      MonitorMass.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "MonitorMass.h"
+
+//***********************************************************************
+
+MonitorMass::MonitorMass(){}
+
+//***********************************************************************
+
+MonitorMass::~MonitorMass(){}
+
+//***********************************************************************
+
+std::string MonitorMass::getName(const int &numValue) const
+{
+  return "massPhase" + std::to_string(numValue);
+}
+
+//***********************************************************************
+
+void MonitorMass::accumulate(Cell *cell, const int &numberPhases, double *values) const
+{
+  const double &volume(cell->getElement()->getVolume());
+  if (numberPhases == 1) { values[0] += cell->getPhase(0)->getDensity()*volume; return; }
+  for (int k = 0; k < numberPhases; k++) {
+    values[k] += cell->getPhase(k)->getAlpha()*cell->getPhase(k)->getDensity()*volume;
+  }
+}
+
+//***********************************************************************
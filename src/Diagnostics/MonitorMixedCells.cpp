@@ -0,0 +1,72 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      MonitorMixedCells.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "MonitorMixedCells.h"
+
+using namespace tinyxml2;
+
+//***********************************************************************
+
+MonitorMixedCells::MonitorMixedCells() : m_epsilon(1.e-3) {}
+
+//***********************************************************************
+
+MonitorMixedCells::MonitorMixedCells(XMLElement *element, std::string fileName) : m_epsilon(1.e-3)
+{
+  XMLError error(element->QueryDoubleAttribute("epsilon", &m_epsilon));
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || m_epsilon <= 0. || m_epsilon >= 0.5) throw ErrorXMLAttribut("epsilon", fileName, __FILE__, __LINE__);
+}
+
+//***********************************************************************
+
+MonitorMixedCells::~MonitorMixedCells(){}
+
+//***********************************************************************
+
+void MonitorMixedCells::initialize(const int &numberPhases)
+{
+  if (numberPhases == 1) throw ErrorECOGEN("monitor mixedCells not available for a single phase model", __FILE__, __LINE__);
+}
+
+//***********************************************************************
+
+void MonitorMixedCells::accumulate(Cell *cell, const int &numberPhases, double *values) const
+{
+  for (int k = 0; k < numberPhases; k++) {
+    if (cell->getPhase(k)->getAlpha() > 1. - m_epsilon) return;
+  }
+  values[0] += 1.;
+}
+
+//***********************************************************************
@@ -0,0 +1,61 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MONITORMIXEDCELLS_H
+#define MONITORMIXEDCELLS_H
+
+//! \file      MonitorMixedCells.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "Monitor.h"
+
+//! \class     MonitorMixedCells
+//! \brief     Number of leaf cells where no phase has a volume fraction above 1 - epsilon
+class MonitorMixedCells : public Monitor
+{
+  public:
+    MonitorMixedCells();
+    //! \brief     Mixed cells monitor constructor from a XML format reading
+    //! \details   ex: <monitor type="mixedCells" epsilon="1.e-3"/>  (1.e-3 by default)
+    //! \param     element          XML element of the monitor
+    //! \param     fileName         string name of readed XML file
+    MonitorMixedCells(tinyxml2::XMLElement *element, std::string fileName);
+    virtual ~MonitorMixedCells();
+
+    virtual void initialize(const int &numberPhases);
+    virtual std::string getName(const int &numValue) const { return "mixedCells"; };
+    virtual void accumulate(Cell *cell, const int &numberPhases, double *values) const;
+
+  private:
+    double m_epsilon;   //!< Volume fraction threshold of a pure cell
+};
+
+#endif // MONITORMIXEDCELLS_H
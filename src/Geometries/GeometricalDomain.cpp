@@ -44,7 +44,8 @@ GeometricalDomain::GeometricalDomain(std::string name, std::vector<Phase*> vecPh
   for (int k = 0; k < m_numberPhases; k++){
     vecPhases[k]->allocateAndCopyPhase(&m_vecPhases[k]);
   }
-  mixture->allocateAndCopyMixture(&m_mixture);
+  m_mixture = 0;
+  if (mixture != 0) { mixture->allocateAndCopyMixture(&m_mixture); } //No state when only the shape is used (e.g. AMR refinement regions)
   if (m_numberTransports > 0) { m_vecTransports = new Transport[m_numberTransports]; }
   for (int k = 0; k < m_numberTransports; k++) {
     m_vecTransports[k].setValue(vecTransports[k].getValue());
@@ -32,6 +32,8 @@
 //! \version   1.0
 //! \date      May 03 2018
 
+#include <thread>
+#include <zlib.h>
 #include "IO.h"
 #include "../Errors.h"
 
@@ -110,4 +112,99 @@ void IO::copieFichier(std::string file, std::string dossierSource, std::string d
   catch (ErrorECOGEN &) { throw; }
 }
 
-//***********************************************************************
\ No newline at end of file
+//***********************************************************************
+bool IO::bigEndian()
+{
+  int entierTest = 42; //En binary 0x2a
+  return (reinterpret_cast<char*>(&entierTest)[0] != 0x2a);
+}
+
+//***********************************************************************
+
+uint32_t IO::crc32(const char *data, size_t taille)
+{
+  //Table computed once for the reflected polynomial 0xEDB88320
+  static uint32_t table[256];
+  static bool tableReady(false);
+  if (!tableReady) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) { c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1; }
+      table[i] = c;
+    }
+    tableReady = true;
+  }
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < taille; i++) {
+    crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+//***********************************************************************
+
+void IO::ecritBloc(std::ostream &fluxSortie, const std::vector<char> &bloc)
+{
+  std::vector<char> enTete, fin;
+  IO::ajouteLittleEndian(enTete, static_cast<uint64_t>(bloc.size()));
+  IO::ajouteLittleEndian(fin, IO::crc32(bloc.data(), bloc.size()));
+  fluxSortie.write(enTete.data(), enTete.size());
+  if (!bloc.empty()) fluxSortie.write(bloc.data(), bloc.size());
+  fluxSortie.write(fin.data(), fin.size());
+}
+
+//***********************************************************************
+
+void IO::litBloc(std::istream &fluxEntree, std::vector<char> &bloc, const std::string &nameBloc)
+{
+  std::vector<char> tampon(sizeof(uint64_t));
+  size_t pos(0);
+  uint64_t taille(0);
+  uint32_t crc(0);
+  if (!fluxEntree.read(tampon.data(), tampon.size())) throw ErrorECOGEN("IO::litBloc : truncated " + nameBloc + " block", __FILE__, __LINE__);
+  IO::extraitLittleEndian(tampon, pos, taille);
+  bloc.resize(taille);
+  if (taille > 0 && !fluxEntree.read(bloc.data(), taille)) throw ErrorECOGEN("IO::litBloc : truncated " + nameBloc + " block", __FILE__, __LINE__);
+  tampon.resize(sizeof(uint32_t)); pos = 0;
+  if (!fluxEntree.read(tampon.data(), tampon.size())) throw ErrorECOGEN("IO::litBloc : truncated " + nameBloc + " block", __FILE__, __LINE__);
+  IO::extraitLittleEndian(tampon, pos, crc);
+  if (crc != IO::crc32(bloc.data(), bloc.size())) throw ErrorECOGEN("IO::litBloc : CRC-32 mismatch in " + nameBloc + " block", __FILE__, __LINE__);
+}
+
+//***********************************************************************
+
+void IO::compresseZlib(const char *data, size_t taille, size_t tailleBloc, int niveau, int nbThreads,
+  std::vector<uint64_t> &taillesCompressees, std::vector<char> &compresse)
+{
+  size_t nbBlocs((taille + tailleBloc - 1) / tailleBloc);
+  std::vector< std::vector<char> > blocs(nbBlocs);
+  std::vector<int> erreurs(nbBlocs, Z_OK);
+
+  //Compression des blocs i, i + nbThreads, i + 2 nbThreads... par le thread i
+  auto compresseBlocs = [&](size_t premier, size_t pas) {
+    for (size_t b = premier; b < nbBlocs; b += pas) {
+      size_t debut(b * tailleBloc);
+      uLong tailleSource(static_cast<uLong>(std::min(tailleBloc, taille - debut)));
+      uLongf tailleCompressee(compressBound(tailleSource));
+      blocs[b].resize(tailleCompressee);
+      erreurs[b] = compress2(reinterpret_cast<Bytef*>(blocs[b].data()), &tailleCompressee, reinterpret_cast<const Bytef*>(data + debut), tailleSource, niveau);
+      blocs[b].resize(tailleCompressee);
+    }
+  };
+  size_t nbThreadsUtiles(std::max(1, std::min(nbThreads, static_cast<int>(nbBlocs))));
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < nbThreadsUtiles; t++) { threads.push_back(std::thread(compresseBlocs, t, nbThreadsUtiles)); }
+  compresseBlocs(0, nbThreadsUtiles);
+  for (unsigned int t = 0; t < threads.size(); t++) { threads[t].join(); }
+
+  //Concatenation des blocs compresses
+  taillesCompressees.resize(nbBlocs);
+  compresse.clear();
+  for (size_t b = 0; b < nbBlocs; b++) {
+    if (erreurs[b] != Z_OK) throw ErrorECOGEN("IO::compresseZlib : zlib compression failed", __FILE__, __LINE__);
+    taillesCompressees[b] = blocs[b].size();
+    compresse.insert(compresse.end(), blocs[b].begin(), blocs[b].end());
+  }
+}
+
+//***********************************************************************
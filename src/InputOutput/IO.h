@@ -38,6 +38,9 @@
 #include <fstream>
 #include <algorithm>
 #include <sstream>
+#include <vector>
+#include <cstdint>
+#include "../Errors.h"
 
 class IO
 {
@@ -123,6 +126,44 @@ public:
 
   static std::ostream& writeb64Chaine(std::ostream &fluxSortie, char *chaineAEncoder, int &taille);
 
+  //Format binaire brut little-endian pour les checkpoints
+  //------------------------------------------------------
+
+  //Ajout d une valeur a un bloc binaire (stockage little-endian quel que soit le processeur)
+  template <typename T>
+  static void ajouteLittleEndian(std::vector<char> &bloc, T value)
+  {
+    if (IO::bigEndian()) IO::endswap(&value);
+    char *conversionChaine = reinterpret_cast<char*>(&value);
+    bloc.insert(bloc.end(), conversionChaine, conversionChaine + sizeof(T));
+  }
+
+  //Lecture d une valeur little-endian a la position pos d un bloc binaire
+  template <typename T>
+  static void extraitLittleEndian(const std::vector<char> &bloc, size_t &pos, T &value)
+  {
+    if (pos + sizeof(T) > bloc.size()) throw ErrorECOGEN("IO::extraitLittleEndian : unexpected end of binary block", __FILE__, __LINE__);
+    std::copy(bloc.begin() + pos, bloc.begin() + pos + sizeof(T), reinterpret_cast<char*>(&value));
+    if (IO::bigEndian()) IO::endswap(&value);
+    pos += sizeof(T);
+  }
+
+  static bool bigEndian();
+  //! \brief     CRC-32 checksum (IEEE 802.3 polynomial) of a block of bytes
+  static uint32_t crc32(const char *data, size_t taille);
+  //! \brief     Write a binary block as: size (uint64), bytes, CRC-32 (uint32)
+  static void ecritBloc(std::ostream &fluxSortie, const std::vector<char> &bloc);
+  //! \brief     Read a binary block written by ecritBloc, throws if the CRC-32 does not match
+  static void litBloc(std::istream &fluxEntree, std::vector<char> &bloc, const std::string &nameBloc);
+
+  //Compression zlib par blocs (DataArray compresses du format XML VTK)
+  //--------------------------------------------------------------------
+  //! \brief     Compress a buffer as independent zlib blocks of tailleBloc bytes (the last one may be partial)
+  //! \details   Blocks are distributed among nbThreads threads and concatenated in order in compresse
+  //! \param     taillesCompressees   compressed size of each block
+  static void compresseZlib(const char *data, size_t taille, size_t tailleBloc, int niveau, int nbThreads,
+    std::vector<uint64_t> &taillesCompressees, std::vector<char> &compresse);
+
   static void copieFichier(std::string file, std::string dossierSource, std::string dossierDestination);
 
 private:
@@ -138,6 +138,19 @@ void Input::entreeMain(std::string casTest)
       m_run->m_probes.push_back(new OutputProbeGNU(casTest, xmlText->Value(), element, fileName.str(), this));
       element = element->NextSiblingElement("probe");
     }
+    //Reading probe arrays
+    element = computationParam->FirstChildElement("probeArray");
+    while (element != NULL)
+    {
+      m_run->m_probeArrays.push_back(new OutputProbeArray(casTest, xmlText->Value(), element, fileName.str(), this));
+      element = element->NextSiblingElement("probeArray");
+    }
+    //Reading in-situ diagnostics (optional)
+    element = computationParam->FirstChildElement("diagnostics");
+    if (element != NULL) { m_run->m_diagnostics = new Diagnostics(element, fileName.str()); }
+    //Reading live telemetry (optional)
+    element = computationParam->FirstChildElement("telemetry");
+    if (element != NULL) { m_run->m_telemetry = new Telemetry(xmlText->Value(), element, fileName.str()); }
     
     //Recuperation Iteration / temps Physique
     element = computationParam->FirstChildElement("timeControlMode");
@@ -255,6 +268,23 @@ void Input::entreeMain(std::string casTest)
       if (error != XML_NO_ERROR) throw ErrorXMLAttribut("restartFileNumber", fileName.str(), __FILE__, __LINE__);
       error = element->QueryIntAttribute("AMRsaveFreq", &m_run->m_restartAMRsaveFreq);
       if (error != XML_NO_ERROR) throw ErrorXMLAttribut("AMRsaveFreq", fileName.str(), __FILE__, __LINE__);
+      //Binary checkpoints (optional)
+      if (element->QueryIntAttribute("checkpointFreq", &m_run->m_checkpointFreq) != XML_NO_ERROR) m_run->m_checkpointFreq = 0;
+      if (m_run->m_checkpointFreq < 0) throw ErrorXMLAttribut("checkpointFreq", fileName.str(), __FILE__, __LINE__);
+    }
+
+    //Profiling options (optional)
+    element = computationParam->FirstChildElement("profiling");
+    if (element != NULL) {
+      bool trace(false);
+      if (element->QueryBoolAttribute("trace", &trace) != XML_NO_ERROR) trace = false;
+      int capaciteTrace(100000);
+      if (element->QueryIntAttribute("traceBuffer", &capaciteTrace) != XML_NO_ERROR) capaciteTrace = 100000;
+      if (capaciteTrace <= 0) throw ErrorXMLAttribut("traceBuffer", fileName.str(), __FILE__, __LINE__);
+      if (trace) m_run->m_stat.configureTrace(capaciteTrace);
+      bool perfCounters(false);
+      if (element->QueryBoolAttribute("perfCounters", &perfCounters) != XML_NO_ERROR) perfCounters = false;
+      m_run->m_stat.configurePerfCounters(perfCounters);
     }
 
   }
@@ -435,7 +465,98 @@ void Input::entreeMesh(std::string casTest)
         if (error != XML_NO_ERROR) throw ErrorXMLAttribut("xiSplit", fileName.str(), __FILE__, __LINE__);
         error = element->QueryDoubleAttribute("xiJoin", &xiJoin);
         if (error != XML_NO_ERROR) throw ErrorXMLAttribut("xiJoin", fileName.str(), __FILE__, __LINE__);
-        m_run->m_mesh = new MeshCartesianAMR(lX, nbX, lY, nbY, lZ, nbZ, stretchX, stretchY, stretchZ, m_run->m_lvlMax, criteriaVar, varRho, varP, varU, varAlpha, xiSplit, xiJoin);
+        //Optional remeshing frequency (global, then per level) and width of the refinement buffer
+        int remeshFreqGlobal(1);
+        error = element->QueryIntAttribute("remeshFreq", &remeshFreqGlobal);
+        if (error == XML_WRONG_ATTRIBUTE_TYPE || remeshFreqGlobal < 1) throw ErrorXMLAttribut("remeshFreq", fileName.str(), __FILE__, __LINE__);
+        std::vector<int> remeshFreq(m_run->m_lvlMax + 1, remeshFreqGlobal);
+        XMLElement *sousElement(element->FirstChildElement("remeshFreq"));
+        while (sousElement != NULL) {
+          int lvl(0), freq(1);
+          error = sousElement->QueryIntAttribute("lvl", &lvl);
+          if (error != XML_NO_ERROR || lvl < 0 || lvl > m_run->m_lvlMax) throw ErrorXMLAttribut("lvl", fileName.str(), __FILE__, __LINE__);
+          error = sousElement->QueryIntAttribute("freq", &freq);
+          if (error != XML_NO_ERROR || freq < 1) throw ErrorXMLAttribut("freq", fileName.str(), __FILE__, __LINE__);
+          remeshFreq[lvl] = freq;
+          sousElement = sousElement->NextSiblingElement("remeshFreq");
+        }
+        //By default, the buffer is widened so that a discontinuity (moving less than one cell per step) stays in the refined zone between two remeshings
+        int xiSmoothingIterations(std::max(2, *std::max_element(remeshFreq.begin(), remeshFreq.end()) + 1));
+        error = element->QueryIntAttribute("xiSmoothingIterations", &xiSmoothingIterations);
+        if (error == XML_WRONG_ATTRIBUTE_TYPE || xiSmoothingIterations < 0) throw ErrorXMLAttribut("xiSmoothingIterations", fileName.str(), __FILE__, __LINE__);
+        //Optional user-defined compiled criteria (see CriteriaAMR/CriterionAMR.h)
+        std::vector<CriterionAMR*> criteria;
+        sousElement = element->FirstChildElement("criterion");
+        while (sousElement != NULL) {
+          criteria.push_back(CriterionAMR::create(sousElement, fileName.str()));
+          sousElement = sousElement->NextSiblingElement("criterion");
+        }
+        //Optional variables used for the refinement from a given level (and finer ones, until overwritten)
+        std::vector< std::vector<bool> > varLvl(m_run->m_lvlMax + 1);
+        varLvl[0].push_back(varRho); varLvl[0].push_back(varP); varLvl[0].push_back(varU); varLvl[0].push_back(varAlpha);
+        std::vector<bool> lvlVariablesRead(m_run->m_lvlMax + 1, false);
+        sousElement = element->FirstChildElement("lvlVariables");
+        while (sousElement != NULL) {
+          int lvl(0);
+          error = sousElement->QueryIntAttribute("lvl", &lvl);
+          if (error != XML_NO_ERROR || lvl < 0 || lvl > m_run->m_lvlMax) throw ErrorXMLAttribut("lvl", fileName.str(), __FILE__, __LINE__);
+          bool var[4] = { varRho, varP, varU, varAlpha };
+          const char* nameVar[4] = { "varRho", "varP", "varU", "varAlpha" };
+          for (int v = 0; v < 4; v++) {
+            error = sousElement->QueryBoolAttribute(nameVar[v], &var[v]);
+            if (error == XML_WRONG_ATTRIBUTE_TYPE) throw ErrorXMLAttribut(nameVar[v], fileName.str(), __FILE__, __LINE__);
+          }
+          varLvl[lvl].assign(var, var + 4);
+          lvlVariablesRead[lvl] = true;
+          sousElement = sousElement->NextSiblingElement("lvlVariables");
+        }
+        for (int lvl = 1; lvl <= m_run->m_lvlMax; lvl++) { if (!lvlVariablesRead[lvl]) { varLvl[lvl] = varLvl[lvl - 1]; } }
+        //Optional refinement regions (shapes of the geometrical domains) with their maximum level
+        std::vector<GeometricalDomain*> refinementRegions;
+        std::vector<int> refinementRegionsLvlMax;
+        std::vector<Phase*> noPhases;
+        std::vector<Transport> noTransports;
+        sousElement = element->FirstChildElement("refinementRegion");
+        while (sousElement != NULL) {
+          int lvlMaxRegion(0);
+          error = sousElement->QueryIntAttribute("lvlMax", &lvlMaxRegion);
+          if (error != XML_NO_ERROR || lvlMaxRegion < 0) throw ErrorXMLAttribut("lvlMax", fileName.str(), __FILE__, __LINE__);
+          const char* typeAttribute(sousElement->Attribute("type"));
+          if (typeAttribute == NULL) throw ErrorXMLAttribut("type", fileName.str(), __FILE__, __LINE__);
+          std::string typeRegion(typeAttribute);
+          Tools::uppercase(typeRegion);
+          std::string nameRegion("refinementRegion");
+          if      (typeRegion == "ENTIREDOMAIN") { refinementRegions.push_back(new GDEntireDomain(nameRegion, noPhases, 0, noTransports, 0)); }
+          else if (typeRegion == "HALFSPACE")    { refinementRegions.push_back(new GDHalfSpace(nameRegion, noPhases, 0, noTransports, sousElement, 0, fileName.str())); }
+          else if (typeRegion == "DISC")         { refinementRegions.push_back(new GDDisc(nameRegion, noPhases, 0, noTransports, sousElement, 0, fileName.str())); }
+          else if (typeRegion == "ELLIPSE")      { refinementRegions.push_back(new GDEllipse(nameRegion, noPhases, 0, noTransports, sousElement, 0, fileName.str())); }
+          else if (typeRegion == "RECTANGLE")    { refinementRegions.push_back(new GDRectangle(nameRegion, noPhases, 0, noTransports, sousElement, 0, fileName.str())); }
+          else if (typeRegion == "PAVEMENT")     { refinementRegions.push_back(new GDPavement(nameRegion, noPhases, 0, noTransports, sousElement, 0, fileName.str())); }
+          else if (typeRegion == "SPHERE")       { refinementRegions.push_back(new GDSphere(nameRegion, noPhases, 0, noTransports, sousElement, 0, fileName.str())); }
+          else if (typeRegion == "ELLIPSOID")    { refinementRegions.push_back(new GDEllipsoid(nameRegion, noPhases, 0, noTransports, sousElement, 0, fileName.str())); }
+          else if (typeRegion == "CYLINDER")     { refinementRegions.push_back(new GDCylinder(nameRegion, noPhases, 0, noTransports, sousElement, 0, fileName.str())); }
+          else { throw ErrorXMLDomaineInconnu(typeRegion, fileName.str(), __FILE__, __LINE__); }
+          refinementRegionsLvlMax.push_back(lvlMaxRegion);
+          sousElement = sousElement->NextSiblingElement("refinementRegion");
+        }
+        MeshCartesianAMR *meshAMR(new MeshCartesianAMR(lX, nbX, lY, nbY, lZ, nbZ, stretchX, stretchY, stretchZ, m_run->m_lvlMax, criteriaVar, varRho, varP, varU, varAlpha, xiSplit, xiJoin,
+          remeshFreq, xiSmoothingIterations, criteria, refinementRegions, refinementRegionsLvlMax, varLvl));
+        m_run->m_mesh = meshAMR;
+        //Optional global cell budget
+        sousElement = element->FirstChildElement("cellBudget");
+        if (sousElement != NULL) {
+          //The budget scales the xi thresholds, which requires a positive xiSplit
+          if (xiSplit <= 0.) throw ErrorXMLAttribut("xiSplit", fileName.str(), __FILE__, __LINE__);
+          int target(0), max(0), freq(10);
+          error = sousElement->QueryIntAttribute("target", &target);
+          if (error != XML_NO_ERROR || target < 1) throw ErrorXMLAttribut("target", fileName.str(), __FILE__, __LINE__);
+          max = target;
+          error = sousElement->QueryIntAttribute("max", &max);
+          if (error == XML_WRONG_ATTRIBUTE_TYPE || max < target) throw ErrorXMLAttribut("max", fileName.str(), __FILE__, __LINE__);
+          error = sousElement->QueryIntAttribute("freq", &freq);
+          if (error == XML_WRONG_ATTRIBUTE_TYPE || freq < 1) throw ErrorXMLAttribut("freq", fileName.str(), __FILE__, __LINE__);
+          meshAMR->setCellBudget(target, max, freq);
+        }
       }
       else {
         m_run->m_mesh = new MeshCartesian(lX, nbX, lY, nbY, lZ, nbZ, stretchX, stretchY, stretchZ);
@@ -852,7 +973,7 @@ void Input::entreeConditionsInitiales(std::string casTest, std::vector<Geometric
       //D)Reading conLim specific data
       //******************************
       if (typeBoundCond == "ABS") { boundCond.push_back(new BoundCondAbs(numBoundCond)); }
-      else if (typeBoundCond == "SYMMETRY") { if (m_run->m_order == "FIRSTORDER") { boundCond.push_back(new BoundCondWall(numBoundCond)); } else { boundCond.push_back(new BoundCondSymmetryO2(numBoundCond)); } }
+      else if (typeBoundCond == "SYMMETRY") { if (m_run->m_order == "FIRSTORDER") { boundCond.push_back(new BoundCondWall(numBoundCond, true)); } else { boundCond.push_back(new BoundCondSymmetryO2(numBoundCond)); } }
       else if (typeBoundCond == "WALL") { if (m_run->m_order == "FIRSTORDER") { boundCond.push_back(new BoundCondWall(numBoundCond)); } else { boundCond.push_back(new BoundCondWallO2(numBoundCond)); } }
       else if (typeBoundCond == "INJECTION") { boundCond.push_back(new BoundCondInj(numBoundCond, element, m_run->m_numberPhases, m_run->m_numberTransports, m_run->m_nameGTR, m_run->m_eos, fileName.str())); }
       else if (typeBoundCond == "TANK") { boundCond.push_back(new BoundCondTank(numBoundCond, element, m_run->m_numberPhases, m_run->m_numberTransports, m_run->m_nameGTR, m_run->m_eos, fileName.str())); }
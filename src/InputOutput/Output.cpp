@@ -32,11 +32,32 @@
 //! \version   1.1
 //! \date      June 5 2019
 
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+#include <sstream>
 #include "Output.h"
 #include "../Run.h"
 
 using namespace tinyxml2;
 
+const size_t Output::TAILLEBLOCZLIB = 32768;
+
+//! \brief     Line of an infoCalcul.out file written before the times were in seconds, with its computation, AMR and communication times (clock ticks) converted to seconds
+static std::string convertTicksToSeconds(const std::string &line)
+{
+  std::istringstream lineIn(line);
+  std::ostringstream lineOut;
+  lineOut.precision(10);
+  std::string word;
+  for (int i = 0; lineIn >> word; i++) {
+    if (i > 0) lineOut << " ";
+    if (i >= 4 && i <= 6) { lineOut << std::atof(word.c_str()) / CLOCKS_PER_SEC; }
+    else { lineOut << word; }
+  }
+  return lineOut.str();
+}
+
 //***********************************************************************
 
 Output::Output(){}
@@ -46,7 +67,8 @@ Output::Output(){}
 //ex :	<outputMode format="XML" binary="false"/>
 
 Output::Output(std::string casTest, std::string nameRun, XMLElement *element, std::string fileName, Input *entree) :
-  m_simulationName(casTest), m_folderOutput(nameRun), m_numFichier(0), m_donneesSeparees(0), m_input(entree)
+  m_simulationName(casTest), m_folderOutput(nameRun), m_appendedRaw(false), m_decalageAppended(0), m_rejoueAppended(false), m_indexAppended(0), m_niveauCompression(0), m_nbThreadsCompression(1),
+  m_numFichier(0), m_donneesSeparees(0), m_input(entree)
 {
   //Affectation pointeur run
   m_run = m_input->getRun();
@@ -57,6 +79,7 @@ Output::Output(std::string casTest, std::string nameRun, XMLElement *element, st
   m_infoMesh = "infoMesh";
   m_treeStructure = "treeStructure";
   m_domainDecomposition = "domainDecomposition";
+  m_checkpoint = "checkpoint";
   m_fileNameResults = "result";
   m_fileNameCollectionParaview = "collectionParaview";
   m_fileNameCollectionVisIt = "collectionVisIt";
@@ -67,6 +90,7 @@ Output::Output(std::string casTest, std::string nameRun, XMLElement *element, st
   m_folderInfoMesh = m_folderOutput + "infoMesh/";
   m_folderCuts = m_folderOutput + "cuts/";
   m_folderProbes = m_folderOutput + "probes/";
+  m_folderCheckpoints = m_folderOutput + "checkpoints/";
 
   //XMLElement *elementCut;
   XMLError error;
@@ -77,6 +101,14 @@ Output::Output(std::string casTest, std::string nameRun, XMLElement *element, st
   //Recuperation mode Ecriture
   error = element->QueryBoolAttribute("binary", &m_ecritBinaire);
   if (error != XML_NO_ERROR) throw ErrorXMLAttribut("binary", fileName, __FILE__, __LINE__);
+  //Raw appended binary data (optional, binary mode only)
+  if (element->QueryBoolAttribute("appended", &m_appendedRaw) != XML_NO_ERROR) m_appendedRaw = false;
+  if (m_appendedRaw && !m_ecritBinaire) throw ErrorXMLAttribut("appended", fileName, __FILE__, __LINE__);
+  //zlib compression of the binary data (optional): level from 1 to 9, 0 for no compression
+  if (element->QueryIntAttribute("compression", &m_niveauCompression) != XML_NO_ERROR) m_niveauCompression = 0;
+  if (m_niveauCompression < 0 || m_niveauCompression > 9 || (m_niveauCompression > 0 && !m_ecritBinaire)) throw ErrorXMLAttribut("compression", fileName, __FILE__, __LINE__);
+  if (element->QueryIntAttribute("compressionThreads", &m_nbThreadsCompression) != XML_NO_ERROR) m_nbThreadsCompression = 1;
+  if (m_nbThreadsCompression < 1) throw ErrorXMLAttribut("compressionThreads", fileName, __FILE__, __LINE__);
 
   //Creation du dossier de sortie ou vidange /Macro selon OS Windows ou Linux
   if (rankCpu == 0) {
@@ -89,6 +121,7 @@ Output::Output(std::string casTest, std::string nameRun, XMLElement *element, st
       _mkdir(m_folderInfoMesh.c_str());
       _mkdir(m_folderCuts.c_str());
       _mkdir(m_folderProbes.c_str());
+      _mkdir(m_folderCheckpoints.c_str());
     #else
       mkdir("./results", S_IRWXU);
       mkdir(m_folderOutput.c_str(), S_IRWXU);
@@ -97,6 +130,7 @@ Output::Output(std::string casTest, std::string nameRun, XMLElement *element, st
       mkdir(m_folderInfoMesh.c_str(), S_IRWXU);
       mkdir(m_folderCuts.c_str(), S_IRWXU);
       mkdir(m_folderProbes.c_str(), S_IRWXU);
+      mkdir(m_folderCheckpoints.c_str(), S_IRWXU);
     #endif
     try {
       //Sauvegarde des fichiers d entrees
@@ -188,12 +222,13 @@ void Output::printTree(Mesh* mesh, std::vector<Cell *> *cellsLvl, int restartAMR
 
 //***********************************************************************
 
-void Output::readDomainDecompostion(Mesh* mesh, int restartSimulation)
+void Output::readDomainDecompostion(Mesh* mesh, int restartSimulation, bool checkpoint)
 {
   try {
     std::ifstream fileStream;
     std::string file;
-    file = m_folderInfoMesh + creationNameFichier(m_domainDecomposition.c_str(), -1, -1, m_numFichier);
+    if (checkpoint) file = m_folderCheckpoints + creationNameFichier(m_domainDecomposition.c_str(), -1, -1, m_numFichier);
+    else file = m_folderInfoMesh + creationNameFichier(m_domainDecomposition.c_str(), -1, -1, m_numFichier);
     fileStream.open(file.c_str());
     mesh->readDomainDecomposition(fileStream);
     fileStream.close();
@@ -220,27 +255,88 @@ void Output::readTree(Mesh *mesh, TypeMeshContainer<Cell *> *cellsLvl, TypeMeshC
         if (splitCell) mesh->refineCellAndCellInterfaces(cellsLvl[lvl][c], addPhys, model, nbCellsTotalAMR);
       }
 
-      if (lvl < mesh->getLvlMax()) {
-        if (Ncpu > 1) {
-          //Refine ghost cells
-          parallel.communicationsSplit(lvl);
-          cellsLvlGhost[lvl + 1].clear();
-          for (unsigned int i = 0; i < cellsLvlGhost[lvl].size(); i++) { cellsLvlGhost[lvl][i]->chooseRefineDeraffineGhost(mesh->getNumberCellsY(), mesh->getNumberCellsZ(), addPhys, model, cellsLvlGhost); }
+      //Refine ghost cells, update persistent communications and arrays of cells and cell interfaces of lvl + 1
+      if (lvl < mesh->getLvlMax()) mesh->updateLvlPlus1(cellsLvl, cellsLvlGhost, cellInterfacesLvl, lvl, addPhys, model, eos);
+    }
+    nbCellsTotalAMR = 0;
+    for (int i = 0; i < cellsLvl[0].size(); i++) { cellsLvl[0][i]->updateNbCellsTotalAMR(nbCellsTotalAMR); }
+    fileStream.close();
+  }
+  catch (ErrorECOGEN &) { throw; }
+}
 
-          //Update of persistent communications of cells lvl + 1
-          parallel.communicationsNumberGhostCells(lvl + 1);
-          parallel.updatePersistentCommunicationsLvlAMR(lvl + 1, mesh->getGeometrie());
-        }
+//***********************************************************************
 
-        //Reconstruction of the arrays of cells and cell interfaces of lvl + 1
-        cellsLvl[lvl + 1].clear();
-        cellInterfacesLvl[lvl + 1].clear();
-        for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->buildLvlCellsAndLvlInternalCellInterfacesArrays(cellsLvl, cellInterfacesLvl); }
-        for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) { cellInterfacesLvl[lvl][i]->constructionTableauCellInterfacesExternesLvl(cellInterfacesLvl); }
+void Output::writeCheckpoint(Mesh* mesh, std::vector<Cell *> *cellsLvl, int checkpointFreq)
+{
+  if (checkpointFreq == 0) return;
+  if ((m_numFichier % checkpointFreq) != 0) return;
+  try {
+    std::ofstream fileStream;
+    std::string file;
+    int lvlMax = mesh->getLvlMax();
+
+    //Domain decomposition (needed to rebuild the level-0 parallel partition)
+    if (mesh->getType() == AMR && rankCpu == 0) {
+      file = m_folderCheckpoints + creationNameFichier(m_domainDecomposition.c_str(), -1, -1, m_numFichier);
+      fileStream.open(file.c_str());
+      mesh->printDomainDecomposition(fileStream);
+      fileStream.close();
+    }
+
+    //Cell states, level by level, in the order of the cell arrays
+    std::vector<double> data;
+    std::vector<int> split;
+    for (int lvl = 0; lvl <= lvlMax; lvl++) {
+      for (unsigned int c = 0; c < cellsLvl[lvl].size(); c++) { cellsLvl[lvl][c]->fillDataToSend(data, split, lvl); }
+    }
+    int numberCells(0);
+    for (int lvl = 0; lvl <= lvlMax; lvl++) { numberCells += cellsLvl[lvl].size(); }
+    uint32_t numberDataPerCell(0);
+    if (numberCells > 0) numberDataPerCell = data.size() / numberCells;
+
+    //Header
+    std::vector<char> header;
+    const std::string magic("ECOGENCK");
+    header.insert(header.end(), magic.begin(), magic.end());
+    IO::ajouteLittleEndian(header, static_cast<uint32_t>(1)); //Format version
+    IO::ajouteLittleEndian(header, static_cast<int32_t>(m_run->m_numberPhases));
+    IO::ajouteLittleEndian(header, static_cast<int32_t>(m_run->m_numberTransports));
+    IO::ajouteLittleEndian(header, static_cast<int32_t>(lvlMax));
+    IO::ajouteLittleEndian(header, static_cast<int32_t>(Ncpu));
+    IO::ajouteLittleEndian(header, static_cast<int32_t>(rankCpu));
+    const std::string &model(m_run->m_model->whoAmI());
+    IO::ajouteLittleEndian(header, static_cast<uint32_t>(model.size()));
+    header.insert(header.end(), model.begin(), model.end());
+    IO::ajouteLittleEndian(header, static_cast<int32_t>(m_numFichier));
+    IO::ajouteLittleEndian(header, static_cast<int32_t>(m_run->m_iteration));
+    IO::ajouteLittleEndian(header, m_run->m_physicalTime);
+    IO::ajouteLittleEndian(header, m_run->m_dtNext);
+    IO::ajouteLittleEndian(header, numberDataPerCell);
+    for (int lvl = 0; lvl <= lvlMax; lvl++) { IO::ajouteLittleEndian(header, static_cast<uint64_t>(cellsLvl[lvl].size())); }
+
+    //Split tree, one bit per cell of levels 0 to lvlMax - 1
+    std::vector<char> tree;
+    int bit(0);
+    for (int lvl = 0; lvl < lvlMax; lvl++) {
+      for (unsigned int c = 0; c < cellsLvl[lvl].size(); c++) {
+        if (bit % 8 == 0) tree.push_back(0);
+        if (cellsLvl[lvl][c]->getSplit()) tree.back() |= static_cast<char>(1 << (bit % 8));
+        bit++;
       }
     }
-    nbCellsTotalAMR = 0;
-    for (int i = 0; i < cellsLvl[0].size(); i++) { cellsLvl[0][i]->updateNbCellsTotalAMR(nbCellsTotalAMR); }
+
+    //Cell states
+    std::vector<char> states;
+    states.reserve(data.size()*sizeof(double));
+    for (unsigned int i = 0; i < data.size(); i++) { IO::ajouteLittleEndian(states, data[i]); }
+
+    file = m_folderCheckpoints + creationNameFichier(m_checkpoint.c_str(), -1, rankCpu, m_numFichier);
+    fileStream.open(file.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!fileStream) throw ErrorECOGEN("Output::writeCheckpoint: cannot open file " + file, __FILE__, __LINE__);
+    IO::ecritBloc(fileStream, header);
+    IO::ecritBloc(fileStream, tree);
+    IO::ecritBloc(fileStream, states);
     fileStream.close();
   }
   catch (ErrorECOGEN &) { throw; }
@@ -248,6 +344,118 @@ void Output::readTree(Mesh *mesh, TypeMeshContainer<Cell *> *cellsLvl, TypeMeshC
 
 //***********************************************************************
 
+bool Output::checkpointAvailable() const
+{
+  std::string file = m_folderCheckpoints + creationNameFichier(m_checkpoint.c_str(), -1, rankCpu, m_numFichier);
+  std::ifstream fileStream(file.c_str(), std::ios::binary);
+  int available(fileStream.good()), availableAllCPU(0);
+  MPI_Allreduce(&available, &availableAllCPU, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  return (availableAllCPU == 1);
+}
+
+//***********************************************************************
+
+void Output::readCheckpoint(Mesh *mesh, TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, TypeMeshContainer<CellInterface *> *cellInterfacesLvl,
+  const std::vector<AddPhys*> &addPhys, Model *model, Eos **eos, int &nbCellsTotalAMR)
+{
+  std::string file = m_folderCheckpoints + creationNameFichier(m_checkpoint.c_str(), -1, rankCpu, m_numFichier);
+  std::vector<char> tree;
+  std::vector<double> data;
+  std::vector<uint64_t> numberCellsLvl;
+  uint32_t numberDataPerCell(0);
+  int lvlMax = mesh->getLvlMax();
+
+  //Reading and verification (every CPU stops together if one checkpoint is invalid)
+  int errorLocal(0), errorAllCPU(0);
+  ErrorECOGEN errorRead;
+  try {
+    std::ifstream fileStream;
+    fileStream.open(file.c_str(), std::ios::in | std::ios::binary);
+    if (!fileStream) throw ErrorECOGEN("Output::readCheckpoint: cannot open file " + file, __FILE__, __LINE__);
+    std::vector<char> header, states;
+    IO::litBloc(fileStream, header, "header of " + file);
+    IO::litBloc(fileStream, tree, "tree of " + file);
+    IO::litBloc(fileStream, states, "states of " + file);
+    fileStream.close();
+
+    //Header
+    size_t pos(8);
+    uint32_t version, modelSize;
+    int32_t numberPhases, numberTransports, lvlMaxRead, numberCPU, rank, numFichier, iteration;
+    if (header.size() < pos || std::string(header.begin(), header.begin() + pos) != "ECOGENCK") throw ErrorECOGEN("Output::readCheckpoint: " + file + " is not an ECOGEN checkpoint", __FILE__, __LINE__);
+    IO::extraitLittleEndian(header, pos, version);
+    if (version != 1) throw ErrorECOGEN("Output::readCheckpoint: unknown checkpoint version in " + file, __FILE__, __LINE__);
+    IO::extraitLittleEndian(header, pos, numberPhases);
+    IO::extraitLittleEndian(header, pos, numberTransports);
+    IO::extraitLittleEndian(header, pos, lvlMaxRead);
+    IO::extraitLittleEndian(header, pos, numberCPU);
+    IO::extraitLittleEndian(header, pos, rank);
+    IO::extraitLittleEndian(header, pos, modelSize);
+    if (pos + modelSize > header.size()) throw ErrorECOGEN("Output::readCheckpoint: corrupted header in " + file, __FILE__, __LINE__);
+    std::string modelName(header.begin() + pos, header.begin() + pos + modelSize);
+    pos += modelSize;
+    IO::extraitLittleEndian(header, pos, numFichier);
+    IO::extraitLittleEndian(header, pos, iteration);
+    IO::extraitLittleEndian(header, pos, m_run->m_physicalTime);
+    IO::extraitLittleEndian(header, pos, m_run->m_dt);
+    IO::extraitLittleEndian(header, pos, numberDataPerCell);
+    if (lvlMaxRead != lvlMax) throw ErrorECOGEN("Output::readCheckpoint: maximum AMR level differs from checkpoint", __FILE__, __LINE__);
+    numberCellsLvl.resize(lvlMax + 1);
+    for (int lvl = 0; lvl <= lvlMax; lvl++) { IO::extraitLittleEndian(header, pos, numberCellsLvl[lvl]); }
+    m_run->m_iteration = iteration;
+
+    if (modelName != model->whoAmI()) throw ErrorECOGEN("Output::readCheckpoint: model differs from checkpoint (" + modelName + ")", __FILE__, __LINE__);
+    if (numberPhases != m_run->m_numberPhases || numberTransports != m_run->m_numberTransports) throw ErrorECOGEN("Output::readCheckpoint: numbers of phases or transports differ from checkpoint", __FILE__, __LINE__);
+    if (numberCPU != Ncpu || rank != rankCpu) throw ErrorECOGEN("Output::readCheckpoint: number of CPU differs from checkpoint", __FILE__, __LINE__);
+    if (numFichier != m_numFichier) throw ErrorECOGEN("Output::readCheckpoint: results file number differs from checkpoint", __FILE__, __LINE__);
+    if (cellsLvl[0].size() != numberCellsLvl[0]) throw ErrorECOGEN("Output::readCheckpoint: number of cells differs from checkpoint", __FILE__, __LINE__);
+    std::vector<double> dataRef; std::vector<int> splitRef;
+    m_cellRef.fillDataToSend(dataRef, splitRef, 0); //Reference cell: a CPU may own no cell after load balancing
+    if (numberDataPerCell != dataRef.size()) throw ErrorECOGEN("Output::readCheckpoint: cell state size differs from checkpoint", __FILE__, __LINE__);
+
+    //Block sizes
+    uint64_t numberCells(0), numberSplitFlags(0);
+    for (int lvl = 0; lvl <= lvlMax; lvl++) {
+      numberCells += numberCellsLvl[lvl];
+      if (lvl < lvlMax) numberSplitFlags += numberCellsLvl[lvl];
+    }
+    if (tree.size() != (numberSplitFlags + 7) / 8 || states.size() != numberCells*numberDataPerCell*sizeof(double)) {
+      throw ErrorECOGEN("Output::readCheckpoint: block sizes do not match header in " + file, __FILE__, __LINE__);
+    }
+
+    //Cell states are decoded in a single pass
+    data.resize(numberCells*numberDataPerCell);
+    pos = 0;
+    for (unsigned int i = 0; i < data.size(); i++) { IO::extraitLittleEndian(states, pos, data[i]); }
+  }
+  catch (ErrorECOGEN &e) { errorRead = e; errorLocal = 1; }
+  MPI_Allreduce(&errorLocal, &errorAllCPU, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  if (errorLocal) throw errorRead;
+  if (errorAllCPU) throw ErrorECOGEN("Output::readCheckpoint: invalid checkpoint on another CPU", __FILE__, __LINE__);
+
+  //Level-by-level reconstruction: states of lvl, then refinement and update of lvl + 1
+  try {
+    int counter(0), bit(0);
+    for (int lvl = 0; lvl <= lvlMax; lvl++) {
+      if (cellsLvl[lvl].size() != numberCellsLvl[lvl]) throw ErrorECOGEN("Output::readCheckpoint: tree of level " + IO::toString(lvl) + " differs from checkpoint", __FILE__, __LINE__);
+      for (unsigned int c = 0; c < cellsLvl[lvl].size(); c++) { cellsLvl[lvl][c]->getDataToReceive(data, counter, eos); }
+      if (lvl < lvlMax) {
+        for (unsigned int c = 0; c < cellsLvl[lvl].size(); c++) {
+          if (tree[bit / 8] & (1 << (bit % 8))) mesh->refineCellAndCellInterfaces(cellsLvl[lvl][c], addPhys, model, nbCellsTotalAMR);
+          bit++;
+        }
+        mesh->updateLvlPlus1(cellsLvl, cellsLvlGhost, cellInterfacesLvl, lvl, addPhys, model, eos);
+      }
+    }
+    nbCellsTotalAMR = 0;
+    for (unsigned int i = 0; i < cellsLvl[0].size(); i++) { cellsLvl[0][i]->updateNbCellsTotalAMR(nbCellsTotalAMR); }
+    m_numFichier++;
+  }
+  catch (ErrorECOGEN &) { throw; }
+}
+
+//***********************************************************************
+
 void Output::ecritInfos()
 {
   if (m_run->m_iteration > 0) {
@@ -273,12 +481,120 @@ void Output::saveInfosMailles() const
 
 //***********************************************************************
 
-void Output::ecritJeuDonnees(std::vector<double> jeuDonnees, std::ofstream &fileStream, TypeData typeData)
+void Output::listeJeuxDonnees(Mesh *mesh, std::vector<std::string> &names, std::vector<std::string> &variables, std::vector<int> &vars, std::vector<int> &phases)
+{
+  names.clear(); variables.clear(); vars.clear(); phases.clear();
+
+  //1) Variables des phases
+  //-----------------------
+  for (int phase = 0; phase < m_run->getNumberPhases(); phase++) //For complete output
+  //for (int phase = 0; phase < 1; phase++) //For reduced output
+  {
+    std::string eosName(m_cellRef.getPhase(phase)->getEos()->getName());
+    eosName.erase(eosName.end()-4, eosName.end());
+    for (int var = 1; var <= m_cellRef.getPhase(phase)->getNumberScalars(); var++) {
+      names.push_back("F" + IO::toString(phase) + "_" + m_cellRef.getPhase(phase)->returnNameScalar(var) + "_" + eosName);
+      variables.push_back(m_cellRef.getPhase(phase)->returnNameScalar(var));
+      vars.push_back(var); phases.push_back(phase);
+    }
+    for (int var = 1; var <= m_cellRef.getPhase(phase)->getNumberVectors(); var++) {
+      names.push_back("F" + IO::toString(phase) + "_" + m_cellRef.getPhase(phase)->returnNameVector(var) + "_" + eosName);
+      variables.push_back(m_cellRef.getPhase(phase)->returnNameVector(var));
+      vars.push_back(-var); phases.push_back(phase);
+    }
+  } //Fin phase
+
+  //2) Donnees mixture
+  //------------------
+  if (m_run->m_numberPhases > 1) {
+    int mixture = -1;
+    for (int var = 1; var <= m_cellRef.getMixture()->getNumberScalars(); var++) {
+      names.push_back(m_cellRef.getMixture()->returnNameScalar(var));
+      vars.push_back(var); phases.push_back(mixture);
+    }
+    for (int var = 1; var <= m_cellRef.getMixture()->getNumberVectors(); var++) {
+      names.push_back(m_cellRef.getMixture()->returnNameVector(var));
+      vars.push_back(-var); phases.push_back(mixture);
+    }
+  } //Fin mixture
+
+  //3) Transports et autres...
+  //--------------------------
+  int transport = -2; //For complete output
+  for (int var = 1; var <= m_run->m_numberTransports; var++) {
+    names.push_back("T" + IO::toString(var));
+    vars.push_back(var); phases.push_back(transport);
+  }
+
+  //4) Indicateur xi
+  //----------------
+  if (mesh->getType() == AMR) { //For complete output
+    int xi = -3;
+    names.push_back("Xi");
+    vars.push_back(1); phases.push_back(xi);
+  }
+
+  //5) Gradient rho
+  //---------------
+  int gradRho = -4;
+  names.push_back("gradRho");
+  vars.push_back(1); phases.push_back(gradRho);
+
+  //CPU rank
+  // if (mesh->getType() == AMR) { //For complete output
+  //   int CPUrank = -5;
+  //   names.push_back("CPUrank");
+  //   vars.push_back(1); phases.push_back(CPUrank);
+  // }
+
+  variables.resize(names.size()); //Non phase data sets: the name is the variable
+  for (unsigned int d = 0; d < names.size(); d++) { if (variables[d].empty()) variables[d] = names[d]; }
+}
+
+//***********************************************************************
+
+void Output::ecritJeuDonnees(const std::vector<double> &jeuDonnees, std::ostream &fileStream, TypeData typeData)
 {
   if (m_precision != 0) fileStream.precision(m_precision);
+  if (m_appendedRaw && m_rejoueAppended) { m_indexAppended++; return; } //Data already in the appended section, only the offset is written
+  if (m_appendedRaw) m_offsetsAppended.push_back(m_appendedData.size());
   if (!m_ecritBinaire) {
     for (unsigned int k = 0; k < jeuDonnees.size(); k++) { fileStream << jeuDonnees[k] << " "; }
   }
+  else if (m_niveauCompression > 0) {
+    //zlib blocks: header (number of blocks, uncompressed block size, size of the last partial block, compressed size of each block) + compressed blocks
+    size_t taille(jeuDonnees.size()*tailleTypeData(typeData));
+    m_tamponBrut.resize(taille);
+    convertitBrut(jeuDonnees, typeData, m_tamponBrut.data());
+    std::vector<uint64_t> taillesCompressees;
+    IO::compresseZlib(m_tamponBrut.data(), taille, TAILLEBLOCZLIB, m_niveauCompression, m_nbThreadsCompression, taillesCompressees, m_tamponCompresse);
+    std::vector<uint64_t> entete;
+    entete.push_back(taillesCompressees.size());
+    entete.push_back(TAILLEBLOCZLIB);
+    entete.push_back(taille % TAILLEBLOCZLIB);
+    entete.insert(entete.end(), taillesCompressees.begin(), taillesCompressees.end());
+    if (m_appendedRaw) { //UInt64 header, stored with the blocks until ecritAppendedData
+      const char *debutEntete = reinterpret_cast<const char*>(entete.data());
+      m_appendedData.insert(m_appendedData.end(), debutEntete, debutEntete + entete.size()*sizeof(uint64_t));
+      m_appendedData.insert(m_appendedData.end(), m_tamponCompresse.begin(), m_tamponCompresse.end());
+    }
+    else { //UInt32 header and blocks encoded separately in base64
+      std::vector<uint32_t> entete32(entete.begin(), entete.end());
+      int tailleEntete(entete32.size()*sizeof(uint32_t)), tailleCompressee(m_tamponCompresse.size());
+      IO::writeb64Chaine(fileStream, reinterpret_cast<char*>(entete32.data()), tailleEntete);
+      IO::writeb64Chaine(fileStream, m_tamponCompresse.data(), tailleCompressee);
+    }
+  }
+  else if (m_appendedRaw) {
+    //Block = size in bytes (UInt64 header) + raw values in native byte order, stored until ecritAppendedData
+    size_t taille(jeuDonnees.size()*tailleTypeData(typeData));
+    uint64_t tailleBloc(taille);
+    size_t index(m_appendedData.size());
+    m_appendedData.resize(index + sizeof(uint64_t) + taille);
+    char *chaineTampon = m_appendedData.data() + index;
+    std::memcpy(chaineTampon, &tailleBloc, sizeof(uint64_t));
+    convertitBrut(jeuDonnees, typeData, chaineTampon + sizeof(uint64_t));
+  }
   else {
     int donneeInt; float donneeFloat; double donneeDouble; char donneeChar;
     int taille;
@@ -327,6 +643,67 @@ void Output::ecritJeuDonnees(std::vector<double> jeuDonnees, std::ofstream &file
 
 //***********************************************************************
 
+void Output::convertitBrut(const std::vector<double> &jeuDonnees, TypeData typeData, char *chaineTampon)
+{
+  switch (typeData) {
+  case DOUBLE:
+    std::memcpy(chaineTampon, jeuDonnees.data(), jeuDonnees.size()*sizeof(double));
+    break;
+  case FLOAT:
+    for (unsigned int k = 0; k < jeuDonnees.size(); k++) { reinterpret_cast<float*>(chaineTampon)[k] = static_cast<float>(jeuDonnees[k]); }
+    break;
+  case INT:
+    for (unsigned int k = 0; k < jeuDonnees.size(); k++) { reinterpret_cast<int*>(chaineTampon)[k] = static_cast<int>(std::round(jeuDonnees[k])); }
+    break;
+  case CHAR:
+    for (unsigned int k = 0; k < jeuDonnees.size(); k++) { chaineTampon[k] = static_cast<char>(jeuDonnees[k]); }
+    break;
+  }
+}
+
+//***********************************************************************
+
+size_t Output::tailleTypeData(TypeData typeData)
+{
+  switch (typeData) {
+  case DOUBLE:
+    return sizeof(double);
+  case FLOAT:
+    return sizeof(float);
+  case INT:
+    return sizeof(int);
+  case CHAR:
+    return sizeof(char);
+  }
+  return 0;
+}
+
+//***********************************************************************
+
+std::string Output::formatDataArray() const
+{
+  if (!m_ecritBinaire) return "format=\"ascii\"";
+  if (!m_appendedRaw) return "format=\"binary\"";
+  uint64_t offset(m_appendedData.size());
+  if (m_rejoueAppended) offset = m_offsetsAppended[m_indexAppended];
+  std::stringstream format;
+  format << "format=\"appended\" offset=\"" << m_decalageAppended + offset << "\"";
+  return format.str();
+}
+
+//***********************************************************************
+
+void Output::ecritAppendedData(std::ostream &fileStream)
+{
+  fileStream << "  <AppendedData encoding=\"raw\">" << std::endl << "   _";
+  fileStream.write(m_appendedData.data(), m_appendedData.size());
+  fileStream << std::endl << "  </AppendedData>" << std::endl;
+  m_appendedData.clear();
+  m_offsetsAppended.clear();
+}
+
+//***********************************************************************
+
 void Output::getJeuDonnees(std::istringstream &data, std::vector<double> &jeuDonnees, TypeData typeData)
 {
   if (!m_ecritBinaire) {
@@ -387,6 +764,8 @@ void Output::afficheInfoEcriture() const
   std::cout << "T" << m_run->m_numTest << " | RESULTS FILE NUMBER: " << m_numFichier << ", ITERATION " << m_run->m_iteration << std::endl;
   std::cout << "T" << m_run->m_numTest << " |     Physical time       = " << m_run->m_physicalTime << " s " << std::endl;
   std::cout << "T" << m_run->m_numTest << " |     Last time step      = " << m_run->m_dt << " s " << std::endl;
+  std::cout << "T" << m_run->m_numTest << " |     Memory (accounted)  = " << m_run->m_memoryAccounted / 1048576. << " MB, " << m_run->m_memoryPerLeafCell << " bytes per leaf cell"
+    << " / peak RSS = " << m_run->m_memoryPeak / 1048576. << " MB (max over CPUs)" << std::endl;
   m_run->m_stat.printScreenStats(m_run->m_numTest);
 }
 
@@ -398,12 +777,13 @@ void Output::saveInfos() const
   if (m_precision != 0) fileStream.precision(m_precision);
   if (rankCpu == 0) {
     fileStream.open((m_folderOutput + m_infoCalcul).c_str(), std::ios::app);
-    if(m_numFichier == 0) fileStream << Ncpu << std::endl;
+    //First line: CPU number then the unit of the times ("s": seconds, the files without unit give them in clock ticks)
+    if(m_numFichier == 0) fileStream << Ncpu << " s" << std::endl;
     fileStream << m_numFichier << " " << m_run->m_iteration << " " << m_run->m_physicalTime << " " << m_run->m_dtNext
        << " " << m_run->m_stat.getComputationTime() << " " << m_run->m_stat.getAMRTime() << " " << m_run->m_stat.getCommunicationTime();
 
-    //Additional output with purpose to track the radius of a bubble over time and the maximum pressures.
-    //To comment if not needed. Be carefull when using it, integration for bubble radius and maximum pressure at the wall are not generalized.
+    //Additional output with purpose to track the radius of a bubble over time (maximum pressures: see the pMax and pMaxWall diagnostics monitors).
+    //To comment if not needed. Be carefull when using it, integration for bubble radius is not generalized.
     //-----
     // if (m_run->m_numberPhases > 1) {
     //  double integration(0.);
@@ -412,10 +792,6 @@ void Output::saveInfos() const
     //  }
     //  fileStream << " " << integration;
     // }
-    // // fileStream << " " << m_run->m_pMax[0] << " " << m_run->m_pMax[1] << " " << m_run->m_pMax[2] << " " << m_run->m_pMax[3];
-    // // fileStream << " " << m_run->m_pMaxWall[0] << " " << m_run->m_pMaxWall[1] << " " << m_run->m_pMaxWall[2] << " " << m_run->m_pMaxWall[3];
-    // // fileStream << " " << m_run->m_pMax[0];
-    // // fileStream << " " << m_run->m_pMaxWall[0];
     // fileStream << " " << m_run->m_alphaWanted;
     //-----
 
@@ -432,22 +808,32 @@ void Output::readInfos()
   std::vector<std::stringstream*> chaine(m_run->m_restartSimulation + 2); //1 for CPU number, and 1 for initial conditions
   for (unsigned int i = 0; i < chaine.size(); i++) { chaine[i] = new std::stringstream; }
   std::string chaineTemp;
-  clock_t compTime;
-  clock_t AMRTime;
-  clock_t comTime;
+  double compTime;
+  double AMRTime;
+  double comTime;
   int numberCPURead;
+  std::string unitTimes;
+  bool timesInTicks(false);
   int iter(0);
   try {
     fileStream.open((m_folderOutput + m_infoCalcul).c_str(), std::ios::in); //Opening in reading mode
     //Verifying CPU number
     std::getline(fileStream, chaineTemp);
     *(chaine[iter]) << chaineTemp;
-    *(chaine[iter]) >> numberCPURead;
+    *(chaine[iter]) >> numberCPURead >> unitTimes;
     if (numberCPURead != Ncpu) { throw ErrorECOGEN("restart simulation not possible - number of CPU differs from read files"); }
+    //File written with the times in clock ticks: converted to seconds, the kept lines are rewritten in seconds
+    if (unitTimes != "s") {
+      timesInTicks = true;
+      chaine[iter]->str("");
+      chaine[iter]->clear();
+      *(chaine[iter]) << numberCPURead << " s";
+    }
     iter++;
     //Finding corresponding results files
     do {
       std::getline(fileStream, chaineTemp);
+      if (timesInTicks) { chaineTemp = convertTicksToSeconds(chaineTemp); }
       *(chaine[iter]) << chaineTemp;
       *(chaine[iter]) >> m_numFichier >> m_run->m_iteration >> m_run->m_physicalTime >> m_run->m_dt >> compTime >> AMRTime >> comTime;
       iter++;
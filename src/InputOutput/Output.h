@@ -64,13 +64,17 @@ class Output
     Output(std::string casTest, std::string nameRun, tinyxml2::XMLElement *element, std::string fileName, Input *entree);
     virtual ~Output();
 
-    virtual void locateProbeInMesh(const TypeMeshContainer<Cell *> &cells, const int &nbCells, bool localSeeking = false) { try { throw ErrorECOGEN("locateProbeInMesh not available for requested output format"); } catch (ErrorECOGEN &) { throw; } };
-    virtual Cell* locateProbeInAMRSubMesh(std::vector<Cell*>* cells, const int &nbCells) { try { throw ErrorECOGEN("locateProbeInMesh not available for requested output format"); } catch (ErrorECOGEN &) { throw; } return 0; };
-
     void prepareOutput(const Cell &cell);
     virtual void prepareOutputInfos();
     virtual void ecritSolution(Mesh *mesh, std::vector<Cell *> *cellsLvl) { try { throw ErrorECOGEN("ecritSolution not available for requested output format"); } catch (ErrorECOGEN &) { throw; }};
+    //! \brief     Complete the writings still pending (results files written in background, probe samples kept in memory)
+    virtual void termineEcritures() {};
     void printTree(Mesh* mesh, std::vector<Cell *> *cellsLvl, int m_restartAMRsaveFreq);
+    //! \brief     Write the binary checkpoint of the current CPU (independent of the results format)
+    //! \details   Raw little-endian file made of three blocks, each one followed by its CRC-32: a header (model, numbers of phases and transports,
+    //!            number of cells of each level, time, iteration), the split tree bit-packed level by level and the cell states level by level
+    //! \param     checkpointFreq   a checkpoint is written every checkpointFreq results files (no checkpoint if 0)
+    void writeCheckpoint(Mesh* mesh, std::vector<Cell *> *cellsLvl, int checkpointFreq);
     virtual void ecritInfos();
     void saveInfosMailles() const;
 
@@ -78,12 +82,21 @@ class Output
 
     void readInfos();
     virtual void readResults(Mesh *mesh, std::vector<Cell *> *cellsLvl) { try { throw ErrorECOGEN("readResutls not available for requested output format"); } catch (ErrorECOGEN &) { throw; } };
-    void readDomainDecompostion(Mesh* mesh, int restartSimulation);
+    void readDomainDecompostion(Mesh* mesh, int restartSimulation, bool checkpoint = false);
     void readTree(Mesh *mesh, TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, TypeMeshContainer<CellInterface *> *cellInterfacesLvl,
         const std::vector<AddPhys*> &addPhys, Model *model, Eos **eos, int &nbCellsTotalAMR);
+    //! \brief     Check that the checkpoint files of the restart number exist on every CPU
+    bool checkpointAvailable() const;
+    //! \brief     Rebuild the AMR tree and the cell states from the binary checkpoint of the current CPU
+    //! \details   Header and CRC-32 checksums are verified; time, time step and iteration are restored bitwise
+    void readCheckpoint(Mesh *mesh, TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, TypeMeshContainer<CellInterface *> *cellInterfacesLvl,
+        const std::vector<AddPhys*> &addPhys, Model *model, Eos **eos, int &nbCellsTotalAMR);
+
+    static const size_t TAILLEBLOCZLIB;                 //!<Uncompressed size of the zlib blocks (VTK default)
 
     //Accesseur
     int getNumSortie() const { return m_numFichier; };
+    const std::string &getFolderOutput() const { return m_folderOutput; };
     virtual double getNextTime() { try { throw ErrorECOGEN("getNextTime not available for requested output format"); } catch (ErrorECOGEN &) { throw; } return 0.; }
     virtual bool possesses() { try { throw ErrorECOGEN("possesses not available for requested output format"); } catch (ErrorECOGEN &) { throw; } return false; };
 
@@ -94,7 +107,21 @@ class Output
     void saveInfos() const;
     std::string creationNameFichier(const char* name, int lvl = -1, int proc = -1, int numFichier = -1) const;
 
-    void ecritJeuDonnees(std::vector<double> jeuDonnees, std::ofstream &fileStream, TypeData typeData);
+    //! \brief     List the data sets printed for each cell (phases, mixture, transports, xi, density gradient)
+    //! \param     names            names of the data sets
+    //! \param     variables        names of the variables (name of the data set without phase number and EOS for phase variables)
+    //! \param     vars             numbers of the variables (>0 for scalar, <0 for vector), see Mesh::recupereDonneesSortie
+    //! \param     phases           numbers of the corresponding phases, see Mesh::recupereDonneesSortie
+    void listeJeuxDonnees(Mesh *mesh, std::vector<std::string> &names, std::vector<std::string> &variables, std::vector<int> &vars, std::vector<int> &phases);
+    void ecritJeuDonnees(const std::vector<double> &jeuDonnees, std::ostream &fileStream, TypeData typeData);
+    //! \brief     Size in bytes of one written value of the given type
+    static size_t tailleTypeData(TypeData typeData);
+    //! \brief     Copy the values in native byte order with the given type
+    static void convertitBrut(const std::vector<double> &jeuDonnees, TypeData typeData, char *chaineTampon);
+    //! \brief     Value of the format attribute of a DataArray (with its offset in the appended section in appended mode)
+    std::string formatDataArray() const;
+    //! \brief     Write the raw appended section (one single write) and empty it
+    void ecritAppendedData(std::ostream &fileStream);
     void getJeuDonnees(std::istringstream &data, std::vector<double> &jeuDonnees, TypeData typeData);
 
     Input *m_input;                                     //!<Pointeur vers entree
@@ -106,6 +133,7 @@ class Output
     std::string m_infoMesh;                             //!<Name fichiers pour stocker les infos de mesh
     std::string m_treeStructure;                        //!<File name for tree structure backup
     std::string m_domainDecomposition;                  //!<File name for domain decomposition backup
+    std::string m_checkpoint;                           //!<File name for binary checkpoints
     std::string m_fileNameResults;                      //!<Name du file de sortie resultat
     std::string m_fileNameCollectionParaview;           //!<Name de la collection regroupant les fichiers resultats (for Paraview)
     std::string m_fileNameCollectionVisIt;              //!<Name de la collection regroupant les fichiers resultats (for VisIt)
@@ -115,11 +143,22 @@ class Output
     std::string m_folderInfoMesh;                       //!<Dossier pour stocker les infos de mesh
     std::string m_folderCuts;                           //!<cuts results folder location
     std::string m_folderProbes;                         //!<probes results folder location
+    std::string m_folderCheckpoints;                    //!<binary checkpoints folder location
     std::string m_fichierCollectionParaview;            //!<Chemin du file collection regroupant les fichiers resultats (for Paraview)
     std::string m_fichierCollectionVisIt;               //!<Chemin du file collection regroupant les fichiers resultats (for VisIt)
      
     //attribut parametres d print
     bool m_ecritBinaire;                                //!<Choix print binary/ASCII
+    bool m_appendedRaw;                                 //!<Binary data written as raw bytes in an appended section instead of inline base64 (XML only)
+    std::vector<char> m_appendedData;                   //!<Raw appended section of the file being written (capacity kept between files)
+    uint64_t m_decalageAppended;                        //!<Offset of m_appendedData in the appended section (non zero when the section is shared by several CPUs)
+    bool m_rejoueAppended;                              //!<Appended section already filled: DataArray offsets are taken from m_offsetsAppended
+    std::vector<uint64_t> m_offsetsAppended;            //!<Offset of each DataArray in m_appendedData
+    unsigned int m_indexAppended;                       //!<Next DataArray when m_rejoueAppended
+    int m_niveauCompression;                            //!<zlib compression level of the binary data (0: no compression)
+    int m_nbThreadsCompression;                         //!<Number of threads compressing the zlib blocks
+    std::vector<char> m_tamponBrut;                     //!<Uncompressed values of the DataArray being compressed
+    std::vector<char> m_tamponCompresse;                //!<Compressed blocks of the DataArray being compressed
     bool m_donneesSeparees;                             //!<Choix print donnees dans des fichiers separes
     int m_precision;                                    //!<Output files precision (number of digits) //default: 0
 
@@ -53,6 +53,9 @@ OutputCutGNU::OutputCutGNU(std::string casTest, std::string run, XMLElement *ele
     if (type == LINE) { m_fileNameResults = "cut1D"; }
     else if (type == PLAN) { m_fileNameResults = "cut2D"; }
     else { throw ErrorECOGEN("OutputCutGNU::OutputCutGNU : type de cut inconnu", __FILE__, __LINE__); }
+    if (element->Attribute("name") != NULL) { m_fileNameResults = element->Attribute("name"); } //Optional, needed to distinguish several cuts of the same type
+    if (element->QueryBoolAttribute("binary", &m_binaire) != XML_NO_ERROR) m_binaire = false;
+    m_largeur = 0;
     m_fileNameVisu = "visualisation" + m_fileNameResults + ".gnu";
     m_folderOutput = "./results/" + run + "/cuts/";
     m_donneesSeparees = 0;
@@ -102,23 +105,123 @@ OutputCutGNU::~OutputCutGNU(){}
 
 void OutputCutGNU::ecritSolution(Mesh *mesh, std::vector<Cell *> *cellsLvl)
 {
-  std::ofstream fileStream;
-  std::string file = m_folderOutput + creationNameFichierGNU(m_fileNameResults.c_str(), -1, rankCpu, m_numFichier);
-  fileStream.open(file.c_str());
-  mesh->ecritSolutionGnuplot(cellsLvl, fileStream, m_objet);
-  fileStream << std::endl;
-  fileStream.close();
+  std::vector<Output *> cut(1, this);
+  ecritCoupes(cut, mesh, cellsLvl);
+}
+
+//***********************************************************************
 
+void OutputCutGNU::ecritCoupes(std::vector<Output *> &cuts, Mesh *mesh, std::vector<Cell *> *cellsLvl)
+{
+  if (cuts.empty()) return;
+
+  //1) Rows of every cut in a single traversal of the cells
+  //-------------------------------------------------------
+  std::vector<GeometricObject *> objets(cuts.size());
+  for (unsigned int c = 0; c < cuts.size(); c++) { objets[c] = static_cast<OutputCutGNU *>(cuts[c])->m_objet; }
+  std::vector< std::vector<double> > valeurs;
+  mesh->recupereCoupes(cellsLvl, objets, valeurs);
+
+  //2) Each cut gathered and written by a single CPU
+  //------------------------------------------------
   try {
-    //Creation du file gnuplot pour visualisation des resultats
-    if (rankCpu == 0) {
-      if (m_objet->getType() == LINE) { ecritScriptGnuplot(1); }
-      else if (m_objet->getType() == PLAN) { ecritScriptGnuplot(2); }
-      else { throw ErrorECOGEN("OutputCutGNU::ecritSolutionSpecifique : type de cut inconnu", __FILE__, __LINE__); }
+    std::vector<int> tailles(Ncpu), decalages(Ncpu, 0);
+    for (unsigned int c = 0; c < cuts.size(); c++) {
+      OutputCutGNU *cut = static_cast<OutputCutGNU *>(cuts[c]);
+      int ecrivain = c % Ncpu;
+      if (Ncpu > 1) {
+        int taille = valeurs[c].size();
+        MPI_Gather(&taille, 1, MPI_INT, &tailles[0], 1, MPI_INT, ecrivain, MPI_COMM_WORLD);
+        if (rankCpu == ecrivain) {
+          for (int p = 1; p < Ncpu; p++) { decalages[p] = decalages[p - 1] + tailles[p - 1]; }
+          cut->m_lignes.resize(decalages[Ncpu - 1] + tailles[Ncpu - 1]);
+        }
+        MPI_Gatherv(valeurs[c].data(), taille, MPI_DOUBLE, cut->m_lignes.data(), &tailles[0], &decalages[0], MPI_DOUBLE, ecrivain, MPI_COMM_WORLD);
+      }
+      else { cut->m_lignes.swap(valeurs[c]); }
+      if (rankCpu == ecrivain) { cut->ecritCoupe(cut->m_lignes); }
+      cut->m_numFichier++;
     }
   }
   catch (ErrorECOGEN &) { throw; }
-  m_numFichier++;
+}
+
+//***********************************************************************
+
+void OutputCutGNU::ecritCoupe(std::vector<double> &lignes)
+{
+  //Columns: projected coordinates, then phases, mixture, transports, AMR level and xi (see Cell::printGnuplotAMR)
+  int dim = m_objet->getType();
+  m_largeur = dim + 2 + m_cellRef.getNumberTransports();
+  for (int k = 0; k < m_run->getNumberPhases(); k++) { m_largeur += m_cellRef.getPhase(k)->getNumberScalars() + m_cellRef.getPhase(k)->getNumberVectors(); }
+  m_largeur += m_cellRef.getMixture()->getNumberScalars() + m_cellRef.getMixture()->getNumberVectors();
+  int nbLignes = lignes.size() / m_largeur;
+
+  //Rows sorted by coordinates (x, then y for planes)
+  std::vector<int> ordre(nbLignes);
+  for (int l = 0; l < nbLignes; l++) ordre[l] = l;
+  int largeur(m_largeur);
+  std::stable_sort(ordre.begin(), ordre.end(), [&lignes, largeur, dim](int a, int b) {
+    for (int d = 0; d < dim; d++) {
+      if (lignes[a * largeur + d] != lignes[b * largeur + d]) return lignes[a * largeur + d] < lignes[b * largeur + d];
+    }
+    return false;
+  });
+
+  std::string file = m_folderOutput + nomFichierCoupe(m_numFichier);
+  std::ofstream fileStream;
+  if (m_binaire) {
+    std::vector<double> triees(lignes.size());
+    for (int l = 0; l < nbLignes; l++) { std::copy(lignes.begin() + ordre[l] * m_largeur, lignes.begin() + (ordre[l] + 1) * m_largeur, triees.begin() + l * m_largeur); }
+    fileStream.open(file.c_str(), std::ios::trunc | std::ios::binary);
+    if (!fileStream) { throw ErrorECOGEN("Impossible d ouvrir le file " + file, __FILE__, __LINE__); }
+    fileStream.write(reinterpret_cast<const char*>(triees.data()), triees.size() * sizeof(double));
+  }
+  else {
+    fileStream.open(file.c_str());
+    if (!fileStream) { throw ErrorECOGEN("Impossible d ouvrir le file " + file, __FILE__, __LINE__); }
+    for (int l = 0; l < nbLignes; l++) {
+      for (int v = 0; v < m_largeur; v++) { fileStream << lignes[ordre[l] * m_largeur + v] << " "; }
+      fileStream << "\n";
+    }
+    fileStream << std::endl;
+  }
+  fileStream.close();
+
+  //Creation du file gnuplot pour visualisation des resultats
+  if (dim == LINE) { ecritScriptGnuplot(1); }
+  else if (dim == PLAN) { ecritScriptGnuplot(2); }
+  else { throw ErrorECOGEN("OutputCutGNU::ecritCoupe : type de cut inconnu", __FILE__, __LINE__); }
+}
+
+//***********************************************************************
+
+std::string OutputCutGNU::nomFichierCoupe(int numFichier) const
+{
+  if (m_binaire) {
+    std::stringstream num;
+    num << m_fileNameResults << "_TIME" << numFichier << ".bin";
+    return num.str();
+  }
+  return creationNameFichierGNU(m_fileNameResults.c_str(), -1, -1, numFichier);
+}
+
+//***********************************************************************
+
+void OutputCutGNU::printBlocGnuplot(std::ofstream &fileStream, int &index, const int &dim)
+{
+  if (dim <= 1) { fileStream << "plot"; }
+  else { fileStream << "splot"; }
+  for (int t = 0; t <= m_numFichier; t++) {
+    fileStream << " \"" << nomFichierCoupe(t) << "\"";
+    if (m_binaire) fileStream << " binary format=\"%" << m_largeur << "double\"";
+    if (dim <= 1) { fileStream << " u 1:" << index; }
+    else { fileStream << " u 1:2:" << index; }
+    if (t != m_numFichier) fileStream << ",\\";
+    fileStream << std::endl;
+  }
+  fileStream << "pause(-1)" << std::endl << std::endl;
+  index++;
 }
 
 //***************************************************************
@@ -47,12 +47,26 @@ public:
   virtual ~OutputCutGNU();
 
   virtual void ecritSolution(Mesh *mesh, std::vector<Cell *> *cellsLvl);
+  //! \brief     Write every cut in a single traversal of the cells
+  //! \details   The rows of each cut are gathered on a single CPU (cut c written by CPU c % Ncpu), sorted by coordinates
+  //!            and written in one file per output time (ASCII or raw doubles). Collective.
+  //! \param     cuts              vector of cut outputs (all of type OutputCutGNU)
+  static void ecritCoupes(std::vector<Output *> &cuts, Mesh *mesh, std::vector<Cell *> *cellsLvl);
 
   virtual void prepareOutputInfos() {}; //Aucune infos a ecrire
   virtual void ecritInfos() {};
 
 private:
+  //! \brief     Sort the gathered rows by coordinates and write the cut file of the current output time
+  void ecritCoupe(std::vector<double> &lignes);
+  //! \brief     Name of the cut file of an output time
+  std::string nomFichierCoupe(int numFichier) const;
+  virtual void printBlocGnuplot(std::ofstream &fileStream, int &index, const int &dim);
+
   GeometricObject *m_objet; //droite ou plan de cut
+  bool m_binaire;           //!<Rows written as raw doubles (native byte order) instead of ASCII
+  int m_largeur;            //!<Number of columns of a row (coordinates then printed values)
+  std::vector<double> m_lignes; //!<Gathered rows of the cut (capacity kept between outputs)
 };
 
 #endif //OUTPUTCUTGNU_H
\ No newline at end of file
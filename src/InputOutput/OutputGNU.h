@@ -51,7 +51,7 @@ protected:
   void ecritScriptGnuplot(const int &dim);
 
   std::string creationNameFichierGNU(const char* name, int lvl = -1, int proc = -1, int numFichier = -1, std::string nameVariable = "defaut") const;
-  void printBlocGnuplot(std::ofstream &fileStream, int &index, const int &dim);
+  virtual void printBlocGnuplot(std::ofstream &fileStream, int &index, const int &dim);
 
   std::string m_fileNameVisu;
 };
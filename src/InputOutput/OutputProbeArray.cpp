@@ -0,0 +1,249 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+//! \file      OutputProbeArray.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "OutputProbeArray.h"
+#include "OutputProbeGNU.h"
+#include "../Run.h"
+
+using namespace tinyxml2;
+
+//***************************************************************
+
+OutputProbeArray::OutputProbeArray(std::string casTest, std::string run, XMLElement *element, std::string fileName, Input *entree) :
+  m_nextAcq(0.), m_remaillageFeuilles(-1), m_layoutAEcrire(false), m_nbEchantillons(0)
+{
+  try {
+    //Attributes settings
+    m_ecritBinaire = true;
+    m_appendedRaw = false;
+    m_niveauCompression = 0;
+    m_simulationName = casTest;
+    const char *name = element->Attribute("name");
+    if (name == NULL) throw ErrorXMLAttribut("name", fileName, __FILE__, __LINE__);
+    m_fileNameResults = name;
+    m_folderOutput = "./results/" + run + "/probes/";
+    m_donneesSeparees = 0;
+    m_numFichier = 0;
+    m_input = entree;
+    m_run = m_input->getRun();
+    std::stringstream fichier;
+    fichier << m_folderOutput << m_fileNameResults << "_CPU" << rankCpu << ".bin";
+    m_fichier = fichier.str();
+
+    XMLElement *sousElement;
+    XMLError error;
+
+    //Single points
+    for (sousElement = element->FirstChildElement("vertex"); sousElement != NULL; sousElement = sousElement->NextSiblingElement("vertex")) {
+      m_points.push_back(readPoint(sousElement, "vertex", fileName));
+    }
+    //Lines of points
+    for (sousElement = element->FirstChildElement("line"); sousElement != NULL; sousElement = sousElement->NextSiblingElement("line")) {
+      int number(0);
+      error = sousElement->QueryIntAttribute("number", &number);
+      if (error != XML_NO_ERROR || number < 1) throw ErrorXMLAttribut("number", fileName, __FILE__, __LINE__);
+      Coord begin(readPoint(sousElement->FirstChildElement("begin"), "begin", fileName));
+      Coord end(readPoint(sousElement->FirstChildElement("end"), "end", fileName));
+      for (int i = 0; i < number; i++) {
+        double s = (number > 1) ? static_cast<double>(i) / (number - 1) : 0.;
+        m_points.push_back(begin + s * (end - begin));
+      }
+    }
+    //Planes of points
+    for (sousElement = element->FirstChildElement("plane"); sousElement != NULL; sousElement = sousElement->NextSiblingElement("plane")) {
+      int number1(0), number2(0);
+      error = sousElement->QueryIntAttribute("number1", &number1);
+      if (error != XML_NO_ERROR || number1 < 1) throw ErrorXMLAttribut("number1", fileName, __FILE__, __LINE__);
+      error = sousElement->QueryIntAttribute("number2", &number2);
+      if (error != XML_NO_ERROR || number2 < 1) throw ErrorXMLAttribut("number2", fileName, __FILE__, __LINE__);
+      Coord vertex(readPoint(sousElement->FirstChildElement("vertex"), "vertex", fileName));
+      Coord vector1(readPoint(sousElement->FirstChildElement("vector1"), "vector1", fileName));
+      Coord vector2(readPoint(sousElement->FirstChildElement("vector2"), "vector2", fileName));
+      for (int j = 0; j < number2; j++) {
+        double s2 = (number2 > 1) ? static_cast<double>(j) / (number2 - 1) : 0.;
+        for (int i = 0; i < number1; i++) {
+          double s1 = (number1 > 1) ? static_cast<double>(i) / (number1 - 1) : 0.;
+          m_points.push_back(vertex + s1 * vector1 + s2 * vector2);
+        }
+      }
+    }
+    if (m_points.empty()) throw ErrorXMLElement("vertex", fileName, __FILE__, __LINE__);
+
+    sousElement = element->FirstChildElement("timeControl");
+    if (sousElement == NULL) throw ErrorXMLElement("timeControl", fileName, __FILE__, __LINE__);
+    error = sousElement->QueryDoubleAttribute("acqFreq", &m_acqFreq);
+    if (error != XML_NO_ERROR) throw ErrorXMLAttribut("acqFreq", fileName, __FILE__, __LINE__);
+    m_tailleTampon = 100;
+    error = sousElement->QueryIntAttribute("buffer", &m_tailleTampon);
+    if (error == XML_WRONG_ATTRIBUTE_TYPE || m_tailleTampon < 1) throw ErrorXMLAttribut("buffer", fileName, __FILE__, __LINE__);
+  }
+  catch (ErrorECOGEN &) { throw; }
+}
+
+//***************************************************************
+
+OutputProbeArray::~OutputProbeArray() {}
+
+//***************************************************************
+
+Coord OutputProbeArray::readPoint(XMLElement *element, const std::string &name, const std::string &fileName)
+{
+  if (element == NULL) throw ErrorXMLElement(name, fileName, __FILE__, __LINE__);
+  double x(0.), y(0.), z(0.);
+  if (element->QueryDoubleAttribute("x", &x) != XML_NO_ERROR) throw ErrorXMLAttribut("x", fileName, __FILE__, __LINE__);
+  if (element->QueryDoubleAttribute("y", &y) != XML_NO_ERROR) throw ErrorXMLAttribut("y", fileName, __FILE__, __LINE__);
+  if (element->QueryDoubleAttribute("z", &z) != XML_NO_ERROR) throw ErrorXMLAttribut("z", fileName, __FILE__, __LINE__);
+  return Coord(x, y, z);
+}
+
+//***********************************************************************
+
+void OutputProbeArray::locatePointsInMesh()
+{
+  //Samples recorded with the previous points of the CPU are appended first
+  termineEcritures();
+
+  std::vector<Cell *> cellsPoints;
+  OutputProbeGNU::locatePoints(m_points, m_run->m_cellsLvl[0], m_run->m_mesh->getNumberCells(), cellsPoints);
+  m_indicesLocaux.clear();
+  m_cellsPoints.clear();
+  for (unsigned int p = 0; p < m_points.size(); p++) {
+    if (cellsPoints[p] == 0) continue;
+    m_indicesLocaux.push_back(p);
+    m_cellsPoints.push_back(cellsPoints[p]);
+  }
+  m_feuilles.resize(m_cellsPoints.size());
+  m_remaillageFeuilles = -1;
+  m_layoutAEcrire = true;
+}
+
+//***********************************************************************
+
+void OutputProbeArray::prepareSortieSpecifique()
+{
+  m_nextAcq = 0.;
+  m_tampon.clear();
+  m_nbEchantillons = 0;
+
+  //Columns: data sets of the results files, vectors split in three components
+  std::vector<std::string> names, variables;
+  listeJeuxDonnees(m_run->m_mesh, names, variables, m_vars, m_phases);
+  m_colonnes.clear();
+  for (unsigned int d = 0; d < names.size(); d++) {
+    if (m_vars[d] > 0) { m_colonnes.push_back(names[d]); }
+    else {
+      m_colonnes.push_back(names[d] + "_X");
+      m_colonnes.push_back(names[d] + "_Y");
+      m_colonnes.push_back(names[d] + "_Z");
+    }
+  }
+
+  //File of the CPU (written even without point so that the files are numbered from 0 to Ncpu-1)
+  try {
+    std::ofstream fileStream(m_fichier.c_str(), std::ios::trunc | std::ios::binary);
+    if (!fileStream) { throw ErrorECOGEN("Impossible d ouvrir le file " + m_fichier, __FILE__, __LINE__); }
+    int32_t version(1);
+    fileStream.write("ECOGENPA", 8);
+    fileStream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    fileStream.close();
+  }
+  catch (ErrorECOGEN &) { throw; }
+
+  locatePointsInMesh();
+}
+
+//***********************************************************************
+
+void OutputProbeArray::ecritSolution(Mesh *mesh, std::vector<Cell *> *cellsLvl)
+{
+  m_nextAcq += m_acqFreq;
+  if (m_cellsPoints.empty()) return;
+
+  //Leaf cells containing the points, only located again after a remeshing
+  if (m_remaillageFeuilles != m_run->m_nbRemaillages) {
+    for (unsigned int p = 0; p < m_cellsPoints.size(); p++) { m_feuilles[p] = OutputProbeGNU::locateLeaf(m_points[m_indicesLocaux[p]], m_cellsPoints[p]); }
+    m_remaillageFeuilles = m_run->m_nbRemaillages;
+  }
+
+  //Sample: time then the columns of each point
+  mesh->recupereDonneesCells(m_feuilles, m_vars, m_phases, m_jeuxDonnees);
+  m_tampon.push_back(m_run->m_physicalTime);
+  for (unsigned int p = 0; p < m_feuilles.size(); p++) {
+    for (unsigned int d = 0; d < m_vars.size(); d++) {
+      if (m_vars[d] > 0) { m_tampon.push_back(m_jeuxDonnees[d][p]); }
+      else { m_tampon.insert(m_tampon.end(), m_jeuxDonnees[d].begin() + 3 * p, m_jeuxDonnees[d].begin() + 3 * p + 3); }
+    }
+  }
+  m_nbEchantillons++;
+  if (m_nbEchantillons >= m_tailleTampon) termineEcritures();
+}
+
+//***********************************************************************
+
+void OutputProbeArray::termineEcritures()
+{
+  if (m_nbEchantillons == 0 && !m_layoutAEcrire) return;
+  if (m_nbEchantillons == 0 && m_cellsPoints.empty()) return; //No point: the layout is only written with samples
+
+  std::ofstream fileStream(m_fichier.c_str(), std::ios::app | std::ios::binary);
+  if (!fileStream) { throw ErrorECOGEN("Impossible d ouvrir le file " + m_fichier, __FILE__, __LINE__); }
+  int32_t entier;
+  if (m_layoutAEcrire) {
+    entier = 1; fileStream.write(reinterpret_cast<const char*>(&entier), sizeof(entier));
+    entier = m_indicesLocaux.size(); fileStream.write(reinterpret_cast<const char*>(&entier), sizeof(entier));
+    entier = m_colonnes.size(); fileStream.write(reinterpret_cast<const char*>(&entier), sizeof(entier));
+    for (unsigned int p = 0; p < m_indicesLocaux.size(); p++) {
+      const Coord &point = m_points[m_indicesLocaux[p]];
+      double xyz[3] = { point.getX(), point.getY(), point.getZ() };
+      entier = m_indicesLocaux[p]; fileStream.write(reinterpret_cast<const char*>(&entier), sizeof(entier));
+      fileStream.write(reinterpret_cast<const char*>(xyz), sizeof(xyz));
+    }
+    for (unsigned int c = 0; c < m_colonnes.size(); c++) {
+      entier = m_colonnes[c].size(); fileStream.write(reinterpret_cast<const char*>(&entier), sizeof(entier));
+      fileStream.write(m_colonnes[c].c_str(), m_colonnes[c].size());
+    }
+    m_layoutAEcrire = false;
+  }
+  if (m_nbEchantillons > 0) {
+    entier = 2; fileStream.write(reinterpret_cast<const char*>(&entier), sizeof(entier));
+    entier = m_nbEchantillons; fileStream.write(reinterpret_cast<const char*>(&entier), sizeof(entier));
+    fileStream.write(reinterpret_cast<const char*>(&m_tampon[0]), m_tampon.size() * sizeof(double));
+  }
+  fileStream.close();
+  m_tampon.clear();
+  m_nbEchantillons = 0;
+}
+
+//***************************************************************
@@ -0,0 +1,116 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef OUTPUTPROBEARRAY_H
+#define OUTPUTPROBEARRAY_H
+
+//! \file      OutputProbeArray.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "Output.h"
+
+//! \class     OutputProbeArray
+//! \brief     Recording of a set of point probes, lines and planes of probes in one columnar binary file per CPU
+//! \details   File <name>_CPU<rank>.bin in the probes folder, native byte order (little-endian on usual targets):
+//!              - "ECOGENPA" (8 chars) then version (int32, 1)
+//!              - blocks, each one starting with its type (int32):
+//!                1 (layout):  number of points of the CPU, number of columns (int32),
+//!                             for each point: index in the probe array (int32) and location (3 double),
+//!                             for each column: name length (int32) and name (chars)
+//!                2 (samples): number of samples (int32), for each sample: time then the columns of each point (double)
+//!            A layout block is written again when the points of the CPU change (load balancing).
+//!            Columns are the data sets of the results files, vectors being split in three components.
+//!            The tool tools/probeArrayReader.cpp lists the points and extracts the time series of one point.
+
+class OutputProbeArray : public Output
+{
+public:
+  //! \brief     Probe array output constructor from a XML format reading
+  //! \details   Reading data from XML file under the following format:
+  //!            ex: <probeArray name="pressureProbes">
+  //!                  <vertex x="0.3" y="0.05" z="0.05"/>                     <!-- any number of single points -->
+  //!                  <line number="50">                                      <!-- number points regularly spaced from begin to end -->
+  //!                    <begin x="0." y="0.05" z="0.05"/>
+  //!                    <end x="1." y="0.05" z="0.05"/>
+  //!                  </line>
+  //!                  <plane number1="20" number2="10">                       <!-- number1 x number2 points: vertex + i/(number1-1)*vector1 + j/(number2-1)*vector2 -->
+  //!                    <vertex x="0." y="0." z="0.05"/>
+  //!                    <vector1 x="1." y="0." z="0."/>
+  //!                    <vector2 x="0." y="0.1" z="0."/>
+  //!                  </plane>
+  //!                  <timeControl acqFreq="1e-5" buffer="100"/>             <!-- if acqFreq negative or nul, recording at each time step -->
+  //!                </probeArray>
+  //! \param     casTest           Folder name of test case input files
+  //! \param     run               Resutls folder name (defined in 'mainVX.xml')
+  //! \param     element           XML element to read for probe array data
+  //! \param     fileName          string name of readed XML file
+  //! \param     entree            Pointer to corresponding run entry object
+  OutputProbeArray(std::string casTest, std::string run, tinyxml2::XMLElement *element, std::string fileName, Input *entree);
+  virtual ~OutputProbeArray();
+
+  //! \brief     Locate the points in the mesh (collective, to call again after a load balancing)
+  void locatePointsInMesh();
+
+  virtual void prepareSortieSpecifique();
+  virtual void ecritSolution(Mesh *mesh, std::vector<Cell *> *cellsLvl);
+  //! \brief     Append the samples still in memory to the file of the CPU
+  virtual void termineEcritures();
+
+  virtual void prepareOutputInfos() {}; //nothing to print
+  virtual void ecritInfos() {};
+
+  //Accessors
+  virtual double getNextTime() { return m_nextAcq; };
+  virtual bool possesses() { return true; }; //Every CPU keeps the same acquisition times, even without point
+
+private:
+  //! \brief     Read the location of a point from the x, y and z attributes of an XML element
+  static Coord readPoint(tinyxml2::XMLElement *element, const std::string &name, const std::string &fileName);
+
+  double m_acqFreq;                   //!< Acquisition time frequency
+  double m_nextAcq;                   //!< Next acquisition time
+  std::string m_fichier;              //!< File of the current CPU
+  std::vector<Coord> m_points;        //!< Location of every point of the array
+  std::vector<int> m_indicesLocaux;   //!< Indexes (in m_points) of the points belonging to the CPU
+  std::vector<Cell *> m_cellsPoints;  //!< Level 0 cell containing each point of the CPU
+  std::vector<Cell *> m_feuilles;     //!< Cached leaf cell containing each point of the CPU
+  int m_remaillageFeuilles;           //!< Remeshing counter of the run when m_feuilles have been located (-1: to locate)
+  std::vector<std::string> m_colonnes;//!< Names of the columns of each point
+  std::vector<int> m_vars, m_phases;  //!< Data sets of the columns (see Mesh::recupereDonneesSortie)
+  std::vector< std::vector<double> > m_jeuxDonnees; //!< Data sets extracted at the points of the CPU
+  bool m_layoutAEcrire;               //!< Layout block to write before the next samples
+  std::vector<double> m_tampon;       //!< Samples not yet appended to the file
+  int m_nbEchantillons;               //!< Number of samples in m_tampon
+  int m_tailleTampon;                 //!< Number of samples kept in memory before appending them to the file
+};
+
+#endif //OUTPUTPROBEARRAY_H
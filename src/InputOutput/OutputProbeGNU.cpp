@@ -57,6 +57,11 @@ OutputProbeGNU::OutputProbeGNU(std::string casTest, std::string run, XMLElement
     m_input = entree;
     m_run = m_input->getRun();
     m_possessesProbe = true;
+    m_cell = 0;
+    m_nextAcq = 0.;
+    m_feuille = 0;
+    m_remaillageFeuille = 0;
+    m_nbEchantillons = 0;
 
     XMLElement *sousElement;
     XMLError error;
@@ -75,11 +80,15 @@ OutputProbeGNU::OutputProbeGNU(std::string casTest, std::string run, XMLElement
     if (error != XML_NO_ERROR) throw ErrorXMLAttribut("z", fileName, __FILE__, __LINE__);
 
     m_objet = new GOVertex(vertex);
+    m_position = vertex;
 
     sousElement = element->FirstChildElement("timeControl");
     if (sousElement == NULL) throw ErrorXMLElement("timeControl", fileName, __FILE__, __LINE__);
     error = sousElement->QueryDoubleAttribute("acqFreq", &m_acqFreq);
     if (error != XML_NO_ERROR) throw ErrorXMLAttribut("acqFreq", fileName, __FILE__, __LINE__);
+    m_tailleTampon = 1;
+    error = sousElement->QueryIntAttribute("buffer", &m_tailleTampon);
+    if (error == XML_WRONG_ATTRIBUTE_TYPE || m_tailleTampon < 1) throw ErrorXMLAttribut("buffer", fileName, __FILE__, __LINE__);
   }
   catch (ErrorECOGEN &) { throw; }
 }
@@ -93,50 +102,159 @@ OutputProbeGNU::~OutputProbeGNU()
 
 //***********************************************************************
 
-void OutputProbeGNU::locateProbeInMesh(const TypeMeshContainer<Cell *> &cells, const int &nbCells, bool localSeeking)
+void OutputProbeGNU::locateProbesInMesh(std::vector<Output *> &probes, const TypeMeshContainer<Cell *> &cells, const int &nbCells)
 {
-  //Locate probe in mesh
-  double minimumDistance(1.e12), distance;
-  for (int i = 0; i < nbCells; i++) {
-    distance = m_objet->distancePoint(cells[i]->getPosition());
-    if (distance < minimumDistance) {
-      minimumDistance = distance;
-      m_cell = cells[i];
-      if (distance <= cells[i]->getElement()->getLCFL()) break;
+  int nbProbes = probes.size();
+  if (nbProbes == 0) return;
+
+  //Relocation (after load balancing): pending samples are appended and next acquisition times (only updated by owners) are shared
+  if (Ncpu > 1) {
+    std::vector<double> nextAcqs(nbProbes);
+    for (int p = 0; p < nbProbes; p++) {
+      probes[p]->termineEcritures();
+      nextAcqs[p] = static_cast<OutputProbeGNU *>(probes[p])->m_nextAcq;
     }
+    MPI_Allreduce(MPI_IN_PLACE, &nextAcqs[0], nbProbes, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    for (int p = 0; p < nbProbes; p++) static_cast<OutputProbeGNU *>(probes[p])->m_nextAcq = nextAcqs[p];
   }
-  if(!localSeeking) {
-    //Is probe belonging to this CPU ?
-    if (Ncpu != 1) {
-      double minimumAllCPU(minimumDistance);
-      MPI_Allreduce(&minimumDistance, &minimumAllCPU, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-      if (std::fabs(minimumAllCPU - minimumDistance) > 1.e-10) { m_possessesProbe = false; }
-    }
+
+  std::vector<Coord> points(nbProbes);
+  std::vector<Cell *> cellsProbes;
+  for (int p = 0; p < nbProbes; p++) points[p] = static_cast<OutputProbeGNU *>(probes[p])->m_position;
+  locatePoints(points, cells, nbCells, cellsProbes);
+  for (int p = 0; p < nbProbes; p++) {
+    OutputProbeGNU *probe = static_cast<OutputProbeGNU *>(probes[p]);
+    probe->m_cell = cellsProbes[p];
+    probe->m_possessesProbe = (cellsProbes[p] != 0);
+    probe->m_feuille = 0;
   }
 }
 
 //***********************************************************************
 
-Cell* OutputProbeGNU::locateProbeInAMRSubMesh(std::vector<Cell*> *cells, const int &nbCells)
+void OutputProbeGNU::locatePoints(const std::vector<Coord> &points, const TypeMeshContainer<Cell *> &cells, const int &nbCells, std::vector<Cell *> &cellsPoints)
 {
-  int index = 0;
+  int nbPoints = points.size();
+  cellsPoints.assign(nbPoints, static_cast<Cell *>(0));
+  if (nbPoints == 0) return;
 
-  //Locate probe in AMR Sub-mesh
-  double minimumDistance(1.e12), distance;
+  //1) Uniform grid index of the level 0 cell centers
+  //-------------------------------------------------
+  double boiteMin[3] = { 1.e30, 1.e30, 1.e30 }, boiteMax[3] = { -1.e30, -1.e30, -1.e30 };
+  for (int i = 0; i < nbCells; i++) {
+    const Coord &position = cells[i]->getPosition();
+    double x[3] = { position.getX(), position.getY(), position.getZ() };
+    for (int a = 0; a < 3; a++) {
+      boiteMin[a] = std::min(boiteMin[a], x[a]);
+      boiteMax[a] = std::max(boiteMax[a], x[a]);
+    }
+  }
+  //Bins of similar sizes along the directions having an extent, about one cell per bin
+  int nbDirections(0);
+  double volume(1.), etendueMax(0.);
+  for (int a = 0; a < 3; a++) etendueMax = std::max(etendueMax, boiteMax[a] - boiteMin[a]);
+  for (int a = 0; a < 3; a++) {
+    if (nbCells > 1 && boiteMax[a] - boiteMin[a] > 1.e-12*etendueMax) { volume *= boiteMax[a] - boiteMin[a]; nbDirections++; }
+  }
+  double tailleCible = (nbDirections > 0) ? std::pow(volume / nbCells, 1. / nbDirections) : 1.;
+  int nbBins[3];
+  double tailleBin[3], tailleBinMin(1.e30);
+  for (int a = 0; a < 3; a++) {
+    double etendue = boiteMax[a] - boiteMin[a];
+    nbBins[a] = 1; tailleBin[a] = 1.;
+    if (nbCells > 1 && etendue > 1.e-12*etendueMax) {
+      nbBins[a] = std::max(1, std::min(nbCells, static_cast<int>(etendue / tailleCible)));
+      tailleBin[a] = etendue / nbBins[a];
+      tailleBinMin = std::min(tailleBinMin, tailleBin[a]);
+    }
+  }
+  //Cells sorted by bin (compressed storage: bin b holds the cells indices[debutBin[b]] to indices[debutBin[b+1]-1])
+  std::vector<int> binCellule(nbCells), debutBin(nbBins[0] * nbBins[1] * nbBins[2] + 1, 0), indices(nbCells);
   for (int i = 0; i < nbCells; i++) {
-    distance = m_objet->distancePoint((*cells)[i]->getPosition());
-    if (distance < minimumDistance) {
-      minimumDistance = distance;
-      index = i;
-      if (distance <= (*cells)[i]->getElement()->getLCFL()) break;
+    const Coord &position = cells[i]->getPosition();
+    double x[3] = { position.getX(), position.getY(), position.getZ() };
+    int b(0);
+    for (int a = 2; a >= 0; a--) {
+      int ib = static_cast<int>((x[a] - boiteMin[a]) / tailleBin[a]);
+      b = b * nbBins[a] + std::max(0, std::min(nbBins[a] - 1, ib));
+    }
+    binCellule[i] = b;
+    debutBin[b + 1]++;
+  }
+  for (unsigned int b = 1; b < debutBin.size(); b++) debutBin[b] += debutBin[b - 1];
+  std::vector<int> remplissage(debutBin.begin(), debutBin.end() - 1);
+  for (int i = 0; i < nbCells; i++) indices[remplissage[binCellule[i]]++] = i;
+
+  //2) Nearest cell center of each point, searched by shells of bins of growing distance
+  //-----------------------------------------------------------------------------------
+  //Cells of the shell r+1 and beyond are at least r*tailleBinMin away from the point, stop as soon as the nearest cell found is closer
+  struct DistanceRang { double distance; int rank; }; //Layout of MPI_DOUBLE_INT
+  std::vector<DistanceRang> proprietaires(nbPoints);
+  int nbCouchesMax = std::max(nbBins[0], std::max(nbBins[1], nbBins[2]));
+  for (int p = 0; p < nbPoints; p++) {
+    GOVertex sonde(points[p]);
+    double x[3] = { points[p].getX(), points[p].getY(), points[p].getZ() };
+    int binSonde[3];
+    for (int a = 0; a < 3; a++) {
+      int ib = static_cast<int>(std::floor((x[a] - boiteMin[a]) / tailleBin[a]));
+      binSonde[a] = std::max(0, std::min(nbBins[a] - 1, ib));
+    }
+    double minimumDistance(1.e12), distance;
+    int plusProche(-1);
+    for (int r = 0; r < nbCouchesMax && nbCells > 0; r++) {
+      int debut[3], fin[3];
+      for (int a = 0; a < 3; a++) { debut[a] = std::max(0, binSonde[a] - r); fin[a] = std::min(nbBins[a] - 1, binSonde[a] + r); }
+      for (int k = debut[2]; k <= fin[2]; k++) {
+        for (int j = debut[1]; j <= fin[1]; j++) {
+          for (int i = debut[0]; i <= fin[0]; i++) {
+            //Only the bins of the shell r
+            if (std::max(std::abs(i - binSonde[0]), std::max(std::abs(j - binSonde[1]), std::abs(k - binSonde[2]))) != r) continue;
+            int b = (k * nbBins[1] + j) * nbBins[0] + i;
+            for (int n = debutBin[b]; n < debutBin[b + 1]; n++) {
+              distance = sonde.distancePoint(cells[indices[n]]->getPosition());
+              if (distance < minimumDistance || (distance == minimumDistance && indices[n] < plusProche)) {
+                minimumDistance = distance;
+                plusProche = indices[n];
+              }
+            }
+          }
+        }
+      }
+      if (plusProche >= 0 && minimumDistance <= r * tailleBinMin) break;
     }
+    if (plusProche >= 0) cellsPoints[p] = cells[plusProche];
+    proprietaires[p].distance = minimumDistance;
+    proprietaires[p].rank = rankCpu;
   }
 
-  if (!(*cells)[index]->getSplit()) { return (*cells)[index]; }
-  else {
-    return locateProbeInAMRSubMesh((*cells)[index]->getChildVector(), (*cells)[index]->getChildVector()->size());
+  //3) Is each point belonging to this CPU ? One reduction for all the points
+  //--------------------------------------------------------------------------
+  if (Ncpu > 1) { MPI_Allreduce(MPI_IN_PLACE, &proprietaires[0], nbPoints, MPI_DOUBLE_INT, MPI_MINLOC, MPI_COMM_WORLD); }
+  for (int p = 0; p < nbPoints; p++) {
+    if (proprietaires[p].rank != rankCpu) cellsPoints[p] = 0;
+  }
+}
+
+//***********************************************************************
+
+Cell* OutputProbeGNU::locateLeaf(const Coord &point, Cell *cell)
+{
+  GOVertex sonde(point);
+  while (cell->getSplit()) {
+    std::vector<Cell *> *children = cell->getChildVector();
+    int index = 0;
+    double minimumDistance(1.e12), distance;
+    for (unsigned int i = 0; i < children->size(); i++) {
+      distance = sonde.distancePoint((*children)[i]->getPosition());
+      if (distance < minimumDistance) {
+        minimumDistance = distance;
+        index = i;
+        if (distance <= (*children)[i]->getElement()->getLCFL()) break;
+      }
+    }
+    cell = (*children)[index];
   }
-  return 0;
+  return cell;
 }
 
 //***********************************************************************
@@ -146,8 +264,8 @@ void OutputProbeGNU::prepareSortieSpecifique()
   //settings
   m_nextAcq = 0.;
 
-  //Locate probe in mesh
-  locateProbeInMesh(m_run->m_cellsLvl[0], m_run->m_mesh->getNumberCells()); //KS//FP// If probe doesn't work, look argument m_run->m_cellsLvl[0] here
+  m_tampon.str("");
+  m_nbEchantillons = 0;
 
   //Preparing output files
   try {
@@ -169,21 +287,36 @@ void OutputProbeGNU::prepareSortieSpecifique()
 
 void OutputProbeGNU::ecritSolution(Mesh *mesh, std::vector<Cell *> *cellsLvl)
 {
+  m_tampon << m_run->m_physicalTime << " ";
+  getFeuille()->printGnuplotAMR(m_tampon, 0, m_objet);
+  m_nbEchantillons++;
+  if (m_nbEchantillons >= m_tailleTampon) termineEcritures();
+  m_nextAcq += m_acqFreq;
+}
+
+//***********************************************************************
+
+void OutputProbeGNU::termineEcritures()
+{
+  if (m_nbEchantillons == 0) return;
   std::ofstream fileStream;
   std::string file = m_folderOutput + creationNameFichierGNU(m_fileNameResults.c_str(), -1, -1, -1);
   fileStream.open(file.c_str(), std::ios_base::app);
-  fileStream << m_run->m_physicalTime << " ";
+  fileStream << m_tampon.str();
+  fileStream.close();
+  m_tampon.str("");
+  m_nbEchantillons = 0;
+}
 
-  //Printing solution with AMR treatement if necessary
-  if (!m_cell->getSplit()) {  //if cell is not split
-    m_cell->printGnuplotAMR(fileStream, 0, m_objet);
-  }
-  else { //if cell is split, locate subCells in sub AMR mesh and printing
-    locateProbeInAMRSubMesh(m_cell->getChildVector(), m_cell->getChildVector()->size())->printGnuplotAMR(fileStream, 0, m_objet);
-  }
+//***********************************************************************
 
-  fileStream.close();
-  m_nextAcq += m_acqFreq;
+Cell* OutputProbeGNU::getFeuille()
+{
+  if (m_feuille == 0 || m_remaillageFeuille != m_run->m_nbRemaillages) {
+    m_feuille = locateLeaf(m_position, m_cell);
+    m_remaillageFeuille = m_run->m_nbRemaillages;
+  }
+  return m_feuille;
 }
 
 //***************************************************************
@@ -35,6 +35,7 @@
 //! \version   1.0
 //! \date      February 13 2019
 
+#include <sstream>
 #include "OutputGNU.h"
 #include "../Maths/GOLine.h"
 #include "../Maths/GOPlan.h"
@@ -50,8 +51,9 @@ public:
   //! \details   Reading data from XML file under the following format:
   //!            ex: 	<probe name="capteur1">
   //!                   <vertex x = "0.3" y = "0.05" z = "0.05" / >
-  //!                   <timeControl acqFreq = "1e-5." / >       <!-- if negative or nul, recording at each time step-->
+  //!                   <timeControl acqFreq = "1e-5." buffer = "100" / >       <!-- if negative or nul, recording at each time step-->
   //!                 </probe>
+  //!            The optional attribute buffer gives the number of samples kept in memory before being appended to the probe file (1 by default)
   //! \param     casTest           Folder name of test case input files
   //! \param     run               Resutls folder name (defined in 'mainVX.xml')
   //! \param     element           XML element to read for probe data
@@ -60,11 +62,27 @@ public:
   OutputProbeGNU(std::string casTest, std::string run, tinyxml2::XMLElement *element, std::string fileName, Input *entree);
   virtual ~OutputProbeGNU();
 
-  virtual void locateProbeInMesh(const TypeMeshContainer<Cell *> &cells, const int &nbCells, bool localSeeking = false);
-  virtual Cell* locateProbeInAMRSubMesh(std::vector<Cell*>* cells, const int &nbCells);
+  //! \brief     Locate all the probes in one pass and give each of them to a single CPU (see locatePoints)
+  //! \details   Collective: to call on every CPU, also after a load balancing as level 0 cells may have migrated.
+  //! \param     probes            vector of probe outputs (all of type OutputProbeGNU)
+  //! \param     cells             level 0 cells of the current CPU
+  //! \param     nbCells           number of computed cells (ghost cells excluded)
+  static void locateProbesInMesh(std::vector<Output *> &probes, const TypeMeshContainer<Cell *> &cells, const int &nbCells);
+  //! \brief     Locate a set of points in the level 0 cells, each point being given to a single CPU
+  //! \details   The level 0 cell centers are sorted in a uniform grid (about one cell per bin) which is searched by growing shells
+  //!            around each point. Owners are then set by a single MPI reduction for all the points (lowest rank wins ties). Collective.
+  //! \param     points            points to locate
+  //! \param     cells             level 0 cells of the current CPU
+  //! \param     nbCells           number of computed cells (ghost cells excluded)
+  //! \param     cellsPoints       level 0 cell containing each point, 0 if the point belongs to another CPU
+  static void locatePoints(const std::vector<Coord> &points, const TypeMeshContainer<Cell *> &cells, const int &nbCells, std::vector<Cell *> &cellsPoints);
+  //! \brief     Descend the AMR tree of a level 0 cell down to the leaf containing the point
+  static Cell* locateLeaf(const Coord &point, Cell *cell);
 
   virtual void prepareSortieSpecifique();
   virtual void ecritSolution(Mesh *mesh, std::vector<Cell *> *cellsLvl);
+  //! \brief     Append the samples still in memory to the probe file
+  virtual void termineEcritures();
 
   virtual void prepareOutputInfos() {}; //nothing to print
   virtual void ecritInfos() {};
@@ -75,11 +93,20 @@ public:
 
 
 private:
+  //! \brief     Return the leaf cell containing the probe, the AMR tree being only descended again after a remeshing
+  Cell* getFeuille();
+
   double m_acqFreq;           //!< Acquisition time frequency
   double m_nextAcq;           //!< Next acquisition time
   Cell *m_cell;               //!< Pointer to the level 0 cell containing the probe
+  Cell *m_feuille;            //!< Cached pointer to the leaf cell containing the probe
+  int m_remaillageFeuille;    //!< Remeshing counter of the run when m_feuille has been located
   GeometricObject *m_objet;   //!< To store position
+  Coord m_position;           //!< Probe location
   bool m_possessesProbe;      //!< True if the CPU possesses probe
+  std::ostringstream m_tampon; //!< Samples not yet appended to the probe file
+  int m_nbEchantillons;       //!< Number of samples in m_tampon
+  int m_tailleTampon;         //!< Number of samples kept in memory before appending them to the probe file
 };
 
 #endif //OUTPUTPROBEGNU_H
\ No newline at end of file
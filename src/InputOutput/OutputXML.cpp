@@ -32,6 +32,8 @@
 //! \version   1.1
 //! \date      June 5 2019
 
+#include <algorithm>
+#include <climits>
 #include "OutputXML.h"
 #include "../Run.h"
 
@@ -39,17 +41,56 @@ using namespace tinyxml2;
 
 //***********************************************************************
 
-OutputXML::OutputXML(){}
+OutputXML::OutputXML() : m_typeDonnees(DOUBLE), m_agrege(false), m_nbAgregateurs(0), m_nbInstantanesAsync(0), m_arretEcriture(false) {}
 
 //***********************************************************************
 
 OutputXML::OutputXML(std::string casTest, std::string run, XMLElement *element, std::string fileName, Input *entree) :
-  Output(casTest, run, element, fileName, entree)
-{}
+  Output(casTest, run, element, fileName, entree), m_typeDonnees(DOUBLE), m_agrege(false), m_nbAgregateurs(0), m_nbInstantanesAsync(0), m_arretEcriture(false)
+{
+  //Simple precision output (optional)
+  bool float32(false);
+  if (element->QueryBoolAttribute("float32", &float32) != XML_NO_ERROR) float32 = false;
+  if (float32) m_typeDonnees = FLOAT;
+  //Output profile (optional): names of the data sets to write separated by spaces or commas
+  const char* champs(element->Attribute("fields"));
+  if (champs != NULL) {
+    std::string liste(champs);
+    std::replace(liste.begin(), liste.end(), ',', ' ');
+    std::istringstream flux(liste);
+    std::string champ;
+    while (flux >> champ) m_champs.push_back(champ);
+    if (m_champs.empty()) throw ErrorXMLAttribut("fields", fileName, __FILE__, __LINE__);
+  }
+  //Single results file per output time written with MPI-IO (optional, raw appended mode only)
+  if (element->QueryBoolAttribute("aggregated", &m_agrege) != XML_NO_ERROR) m_agrege = false;
+  if (m_agrege && !m_appendedRaw) throw ErrorXMLAttribut("aggregated", fileName, __FILE__, __LINE__);
+  if (element->QueryIntAttribute("aggregators", &m_nbAgregateurs) != XML_NO_ERROR) m_nbAgregateurs = 0;
+  if (m_nbAgregateurs < 0) throw ErrorXMLAttribut("aggregators", fileName, __FILE__, __LINE__);
+  //Asynchronous writing (optional): maximal number of results files in flight
+  if (element->QueryIntAttribute("asyncSnapshots", &m_nbInstantanesAsync) != XML_NO_ERROR) m_nbInstantanesAsync = 0;
+  if (m_nbInstantanesAsync < 0 || (m_agrege && m_nbInstantanesAsync > 0)) throw ErrorXMLAttribut("asyncSnapshots", fileName, __FILE__, __LINE__); //MPI-IO collective writes are done by the main thread
+  //A writer thread requires at least MPI_THREAD_FUNNELED from the MPI library, else results files are written synchronously
+  int threadSupport(MPI_THREAD_SINGLE);
+  MPI_Query_thread(&threadSupport);
+  if (m_nbInstantanesAsync > 0 && threadSupport < MPI_THREAD_FUNNELED) {
+    if (rankCpu == 0) std::cout << "WARNING: MPI library without MPI_THREAD_FUNNELED support, asyncSnapshots ignored (synchronous writing)" << std::endl;
+    m_nbInstantanesAsync = 0;
+  }
+  for (int i = 0; i < std::max(m_nbInstantanesAsync, 1); i++) {
+    m_instantanes.push_back(new InstantaneXML);
+    m_instantanesLibres.push_back(m_instantanes.back());
+  }
+}
 
 //***********************************************************************
 
-OutputXML::~OutputXML(){}
+OutputXML::~OutputXML()
+{
+  try { termineEcritures(); }
+  catch (ErrorECOGEN &) {}
+  for (unsigned int i = 0; i < m_instantanes.size(); i++) { delete m_instantanes[i]; }
+}
 
 //***********************************************************************
 
@@ -74,7 +115,7 @@ void OutputXML::prepareSortieSpecifique()
     m_fichierCollectionVisIt = m_folderOutput + creationNameFichierXML(m_fileNameCollectionVisIt.c_str(), 0, -1, -1, "visit");
     fileStream.open(m_fichierCollectionVisIt.c_str(), std::ios::trunc);
     if (!fileStream) { throw ErrorECOGEN("Impossible d ouvrir le file " + m_fichierCollectionVisIt, __FILE__, __LINE__); }
-    fileStream << "!NBLOCKS " << Ncpu << std::endl;
+    fileStream << "!NBLOCKS " << (m_agrege ? 1 : Ncpu) << std::endl;
     fileStream.close();
   }
   catch (ErrorECOGEN &) { throw; }
@@ -85,10 +126,24 @@ void OutputXML::prepareSortieSpecifique()
 void OutputXML::ecritSolution(Mesh* mesh, std::vector<Cell *> *cellsLvl)
 {
   try {
-    //Ecriture des fichiers de sortie au format XML
-    ecritSolutionXML(mesh, cellsLvl);
-    //Ajout du file Collection pour grouper les niveaux, les temps, les CPU, etc.
-    if (rankCpu == 0) { ecritCollectionXML(mesh); }
+    if (m_nbInstantanesAsync == 0) {
+      //Ecriture directe des fichiers de sortie au format XML
+      prepareInstantaneXML(mesh, cellsLvl, *m_instantanes[0]);
+      if (m_agrege) ecritSolutionAgregeeXML(mesh, *m_instantanes[0]);
+      else ecritSolutionXML(mesh, *m_instantanes[0]);
+    }
+    else {
+      //Copie des donnees puis encodage / ecriture par le thread d ecriture
+      InstantaneXML *instantane = reserveInstantaneXML();
+      prepareInstantaneXML(mesh, cellsLvl, *instantane);
+      std::lock_guard<std::mutex> verrou(m_mutexEcriture);
+      if (!m_threadEcriture.joinable()) {
+        m_arretEcriture = false;
+        m_threadEcriture = std::thread(&OutputXML::boucleEcriture, this, mesh);
+      }
+      m_instantanesAEcrire.push_back(instantane);
+      m_condEcriture.notify_all();
+    }
   }
   catch (ErrorECOGEN &) { throw; } // Renvoi au niveau suivant
   m_numFichier++;
@@ -96,9 +151,73 @@ void OutputXML::ecritSolution(Mesh* mesh, std::vector<Cell *> *cellsLvl)
 
 //***********************************************************************
 
+InstantaneXML* OutputXML::reserveInstantaneXML()
+{
+  std::unique_lock<std::mutex> verrou(m_mutexEcriture);
+  m_condEcriture.wait(verrou, [this] { return !m_instantanesLibres.empty() || !m_erreurEcriture.empty(); });
+  verrou.unlock();
+  verifieEcritures();
+  verrou.lock();
+  InstantaneXML *instantane = m_instantanesLibres.front();
+  m_instantanesLibres.pop_front();
+  return instantane;
+}
+
+//***********************************************************************
+
+void OutputXML::boucleEcriture(Mesh *mesh)
+{
+  std::unique_lock<std::mutex> verrou(m_mutexEcriture);
+  while (true) {
+    m_condEcriture.wait(verrou, [this] { return !m_instantanesAEcrire.empty() || m_arretEcriture; });
+    if (m_instantanesAEcrire.empty()) break;
+    InstantaneXML *instantane = m_instantanesAEcrire.front();
+    verrou.unlock();
+    std::string erreur;
+    try { ecritSolutionXML(mesh, *instantane); }
+    catch (ErrorECOGEN &e) { erreur = e.infoError(); }
+    verrou.lock();
+    if (!erreur.empty() && m_erreurEcriture.empty()) m_erreurEcriture = erreur;
+    m_instantanesAEcrire.pop_front();
+    m_instantanesLibres.push_back(instantane);
+    m_condEcriture.notify_all();
+  }
+}
+
+//***********************************************************************
+
+void OutputXML::verifieEcritures()
+{
+  std::lock_guard<std::mutex> verrou(m_mutexEcriture);
+  if (!m_erreurEcriture.empty()) {
+    std::string erreur(m_erreurEcriture);
+    m_erreurEcriture.clear();
+    throw ErrorECOGEN("OutputXML: asynchronous writing of a results file failed\n" + erreur, __FILE__, __LINE__);
+  }
+}
+
+//***********************************************************************
+
+void OutputXML::termineEcritures()
+{
+  if (m_threadEcriture.joinable()) {
+    {
+      std::lock_guard<std::mutex> verrou(m_mutexEcriture);
+      m_arretEcriture = true;
+      m_condEcriture.notify_all();
+    }
+    m_threadEcriture.join();
+  }
+  verifieEcritures();
+}
+
+//***********************************************************************
+
 void OutputXML::readResults(Mesh *mesh, std::vector<Cell *> *cellsLvl)
 {
   try {
+    //Reduced or simple precision results files do not hold the complete state (checkpoints do)
+    if (!m_champs.empty() || m_typeDonnees != DOUBLE) throw ErrorECOGEN("OutputXML::readResults: restart needs complete double precision results files (no fields nor float32), use checkpointFreq", __FILE__, __LINE__);
     //1) Parsing XML file
     //-------------------
     std::stringstream fileName(m_folderDatasets + creationNameFichierXML(m_fileNameResults.c_str(), mesh, rankCpu, m_numFichier));
@@ -237,7 +356,8 @@ std::string OutputXML::creationNameFichierXML(const char* name, Mesh *mesh, int
     //Gestion nameVariable
     if ((nameVariable != "defaut") && (nameVariable != "visit")) num << "_" << nameVariable << "_";
     //Gestion binary
-    if (m_ecritBinaire) num << "B64";
+    if (m_appendedRaw) num << "RAW";
+    else if (m_ecritBinaire) num << "B64";
     //Gestion cpu
     if (proc > -1) num << "_CPU" << proc;
     //Gestion number de file resultat
@@ -269,7 +389,51 @@ std::string OutputXML::creationNameFichierXML(const char* name, Mesh *mesh, int
 
 //***********************************************************************
 
-void OutputXML::ecritSolutionXML(Mesh* mesh, std::vector<Cell *> *cellsLvl)
+void OutputXML::prepareInstantaneXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, InstantaneXML &instantane)
+{
+  try {
+    instantane.fichier = m_folderDatasets + creationNameFichierXML(m_fileNameResults.c_str(), mesh, (m_agrege ? -1 : rankCpu), m_numFichier);
+    instantane.numFichier = m_numFichier;
+    instantane.typeMesh = mesh->getType();
+
+    //1) Copie du mesh
+    //----------------
+    std::stringstream entete;
+    switch (mesh->getType()) {
+    case REC:
+      entete << mesh->recupereChaineExtent(rankCpu);
+      instantane.maillage.resize(3);
+      for (unsigned int i = 0; i < instantane.maillage.size(); i++) { instantane.maillage[i].clear(); }
+      mesh->recupereCoord(cellsLvl, instantane.maillage[0], X);
+      mesh->recupereCoord(cellsLvl, instantane.maillage[1], Y);
+      mesh->recupereCoord(cellsLvl, instantane.maillage[2], Z);
+      instantane.typesMaillage.assign(3, m_typeDonnees);
+      break;
+    case UNS: case AMR:
+      mesh->ecritHeaderPiece(entete, cellsLvl);
+      instantane.maillage.resize(4);
+      for (unsigned int i = 0; i < instantane.maillage.size(); i++) { instantane.maillage[i].clear(); }
+      mesh->recupereNoeuds(instantane.maillage[0], cellsLvl);
+      mesh->recupereConnectivite(instantane.maillage[1], cellsLvl);
+      mesh->recupereOffsets(instantane.maillage[2], cellsLvl);
+      mesh->recupereTypeCell(instantane.maillage[3], cellsLvl);
+      instantane.typesMaillage = { m_typeDonnees, INT, INT, CHAR };
+      break;
+    default:
+      throw ErrorECOGEN("Output::prepareInstantaneXML : type mesh inconnu", __FILE__, __LINE__); break;
+    }
+    instantane.entete = entete.str();
+
+    //2) Copie des donnees phases fluides
+    //-----------------------------------
+    prepareDonneesPhysiquesXML(mesh, cellsLvl, instantane);
+  }
+  catch (ErrorECOGEN &) { throw; }
+}
+
+//***********************************************************************
+
+void OutputXML::ecritSolutionXML(Mesh* mesh, const InstantaneXML &instantane)
 {
   std::ofstream fileStream;
 
@@ -277,31 +441,33 @@ void OutputXML::ecritSolutionXML(Mesh* mesh, std::vector<Cell *> *cellsLvl)
       
       //1) Ouverture / creation file
       //-------------------------------
-      std::string file = m_folderDatasets + creationNameFichierXML(m_fileNameResults.c_str(), mesh, rankCpu, m_numFichier);
-      fileStream.open(file.c_str(), std::ios::trunc);
-      if (!fileStream) { throw ErrorECOGEN("Impossible d ouvrir le file " + file, __FILE__, __LINE__); }
+      if (m_appendedRaw) fileStream.open(instantane.fichier.c_str(), std::ios::trunc | std::ios::binary);
+      else fileStream.open(instantane.fichier.c_str(), std::ios::trunc);
+      if (!fileStream) { throw ErrorECOGEN("Impossible d ouvrir le file " + instantane.fichier, __FILE__, __LINE__); }
       fileStream << "<?xml version=\"1.0\"?>" << std::endl;
+      m_appendedData.clear();
+      m_offsetsAppended.clear();
       
       //2) Ecriture du mesh
       //-----------------------
-      switch (mesh->getType()) {
+      switch (instantane.typeMesh) {
       case REC:
-        ecritMeshRectilinearXML(mesh, cellsLvl, fileStream); break;
+        ecritMeshRectilinearXML(mesh, instantane, fileStream); break;
       case UNS:
-        ecritMeshUnstructuredXML(mesh, cellsLvl, fileStream); break;
+        ecritMeshUnstructuredXML(instantane, fileStream); break;
       case AMR:
-        ecritMeshUnstructuredXML(mesh, cellsLvl, fileStream); break;
+        ecritMeshUnstructuredXML(instantane, fileStream); break;
       default:
         throw ErrorECOGEN("Output::ecritSolutionXML : type mesh inconnu", __FILE__, __LINE__); break;
       }
       
       //3) Ecriture des donnees phases fluides
       //--------------------------------------
-      ecritDonneesPhysiquesXML(mesh, cellsLvl, fileStream);
+      ecritDonneesPhysiquesXML(instantane, fileStream);
       
       //4) Finalisation file
       //-----------------------
-      switch (mesh->getType()) {
+      switch (instantane.typeMesh) {
       case REC:
         ecritFinFichierRectilinearXML(fileStream); break;
       case UNS:
@@ -314,15 +480,114 @@ void OutputXML::ecritSolutionXML(Mesh* mesh, std::vector<Cell *> *cellsLvl)
       }
       fileStream.close();
 
+      //5) Ajout du file Collection pour grouper les niveaux, les temps, les CPU, etc.
+      //-------------------------------------------------------------------------------
+      if (rankCpu == 0) { ecritCollectionXML(mesh, instantane.numFichier); }
+
   } //Fin try
   catch (ErrorECOGEN &) { throw; }
 }
 
 //***********************************************************************
 
-void OutputXML::ecritCollectionXML(Mesh *mesh)
+void OutputXML::ecritSolutionAgregeeXML(Mesh *mesh, const InstantaneXML &instantane)
+{
+  try {
+    //1) Encodage des donnees binaires du CPU (piece ecrite a blanc) et position dans la section appended commune
+    //----------------------------------------------------------------------------------------------------------
+    uint64_t tailles[2] = { 0, 0 };   //Piece XML, donnees binaires
+    uint64_t decalages[2] = { 0, 0 };
+    uint64_t totaux[2] = { 0, 0 };
+    auto ecritPiece = [&](std::ostream &flux) {
+      if (instantane.typeMesh == REC) { ecritMeshRectilinearXML(mesh, instantane, flux, false, false); }
+      else { ecritMeshUnstructuredXML(instantane, flux, false, false); }
+      ecritDonneesPhysiquesXML(instantane, flux);
+      flux << "    </Piece>" << std::endl;
+    };
+    std::stringstream aBlanc;
+    m_appendedData.clear();
+    m_offsetsAppended.clear();
+    ecritPiece(aBlanc);
+    tailles[1] = m_appendedData.size();
+    MPI_Exscan(&tailles[1], &decalages[1], 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    if (rankCpu == 0) decalages[1] = 0;
+
+    //2) Piece du CPU (offsets globaux dans la section appended, donnees deja encodees)
+    //---------------------------------------------------------------------------------
+    std::stringstream piece;
+    m_decalageAppended = decalages[1];
+    m_rejoueAppended = true;
+    m_indexAppended = 0;
+    ecritPiece(piece);
+    m_rejoueAppended = false;
+    m_decalageAppended = 0;
+    std::string textePiece(piece.str());
+    tailles[0] = textePiece.size();
+    MPI_Exscan(&tailles[0], &decalages[0], 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    if (rankCpu == 0) decalages[0] = 0;
+    MPI_Allreduce(tailles, totaux, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    //3) Entete, fin des pieces et fin de file (ecrits par le CPU 0)
+    //-------------------------------------------------------------
+    std::string grille("UnstructuredGrid");
+    if (instantane.typeMesh == REC) grille = "RectilinearGrid";
+    std::stringstream entete, finPieces, finFichier;
+    entete << "<?xml version=\"1.0\"?>" << std::endl;
+    entete << "<VTKFile type=\"" << grille << "\" version=\"0.1\" " << attributsVTKFile() << ">" << std::endl;
+    if (instantane.typeMesh == REC) { entete << "  <RectilinearGrid WholeExtent=\"" << mesh->recupereChaineExtent(rankCpu, true) << "\">" << std::endl; }
+    else { entete << "  <UnstructuredGrid>" << std::endl; }
+    finPieces << "  </" << grille << ">" << std::endl << "  <AppendedData encoding=\"raw\">" << std::endl << "   _";
+    finFichier << std::endl << "  </AppendedData>" << std::endl << "</VTKFile>" << std::endl;
+    MPI_Offset debutPieces(entete.str().size());
+    MPI_Offset debutDonnees(debutPieces + totaux[0] + finPieces.str().size());
+
+    //4) Ecritures collectives MPI-IO
+    //-------------------------------
+    int erreur(0), erreurGlobale(0);
+    if (tailles[0] > INT_MAX || tailles[1] > INT_MAX) erreur = 1;
+    MPI_Info info;
+    MPI_Info_create(&info);
+    if (m_nbAgregateurs > 0) {
+      MPI_Info_set(info, const_cast<char*>("cb_nodes"), const_cast<char*>(IO::toString(m_nbAgregateurs).c_str()));
+      MPI_Info_set(info, const_cast<char*>("romio_cb_write"), const_cast<char*>("enable"));
+    }
+    MPI_File fichier;
+    if (MPI_File_open(MPI_COMM_WORLD, const_cast<char*>(instantane.fichier.c_str()), MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &fichier) != MPI_SUCCESS) {
+      MPI_Info_free(&info);
+      throw ErrorECOGEN("Impossible d ouvrir le file " + instantane.fichier, __FILE__, __LINE__);
+    }
+    MPI_Info_free(&info);
+    MPI_Allreduce(&erreur, &erreurGlobale, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if (erreurGlobale == 0) {
+      if (MPI_File_set_size(fichier, 0) != MPI_SUCCESS) erreur = 1;
+      if (MPI_File_write_at_all(fichier, debutPieces + decalages[0], const_cast<char*>(textePiece.data()), static_cast<int>(tailles[0]), MPI_CHAR, MPI_STATUS_IGNORE) != MPI_SUCCESS) erreur = 1;
+      if (MPI_File_write_at_all(fichier, debutDonnees + decalages[1], m_appendedData.data(), static_cast<int>(tailles[1]), MPI_BYTE, MPI_STATUS_IGNORE) != MPI_SUCCESS) erreur = 1;
+      if (rankCpu == 0) {
+        if (MPI_File_write_at(fichier, 0, const_cast<char*>(entete.str().data()), entete.str().size(), MPI_CHAR, MPI_STATUS_IGNORE) != MPI_SUCCESS) erreur = 1;
+        if (MPI_File_write_at(fichier, debutPieces + totaux[0], const_cast<char*>(finPieces.str().data()), finPieces.str().size(), MPI_CHAR, MPI_STATUS_IGNORE) != MPI_SUCCESS) erreur = 1;
+        if (MPI_File_write_at(fichier, debutDonnees + totaux[1], const_cast<char*>(finFichier.str().data()), finFichier.str().size(), MPI_CHAR, MPI_STATUS_IGNORE) != MPI_SUCCESS) erreur = 1;
+      }
+    }
+    MPI_File_close(&fichier);
+    m_appendedData.clear();
+    m_offsetsAppended.clear();
+    MPI_Allreduce(&erreur, &erreurGlobale, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if (erreurGlobale != 0) throw ErrorECOGEN("OutputXML::ecritSolutionAgregeeXML: MPI-IO writing of " + instantane.fichier + " failed", __FILE__, __LINE__);
+
+    //5) Ajout du file Collection
+    //---------------------------
+    if (rankCpu == 0) { ecritCollectionXML(mesh, instantane.numFichier); }
+  }
+  catch (ErrorECOGEN &) { throw; }
+}
+
+//***********************************************************************
+
+void OutputXML::ecritCollectionXML(Mesh *mesh, int numFichier)
 {
   try {
+    int nbParties(Ncpu); //One file per CPU or one aggregated file
+    if (m_agrege) nbParties = 1;
     std::ofstream fileStream;
     //ifstream fileStream2((m_folderOutput + m_infoCalcul).c_str()); //For real-time file name
     //double realTime, a, b, c, d, e, f, g, h, i, j, k, l, m;          //For real-time file name
@@ -336,11 +601,11 @@ void OutputXML::ecritCollectionXML(Mesh *mesh)
     else { fileStream << m_endianMode.c_str() << "\" "; }
     fileStream << "compressor=\"vtkZLibDataCompressor\">";
     fileStream << std::endl << "    <Collection>" << std::endl;
-    for (int time = 0; time <= m_numFichier; time++) {
+    for (int time = 0; time <= numFichier; time++) {
       //fileStream2 >> a >> b >> realTime >> c >> d >> e >> f >> g >> h >> i >> j >> k >> l >> m; //For real-time file name
       //fileStream2 >> a >> b >> realTime >> c >> d;                                              //For real-time file name
-      for (int p = 0; p < Ncpu; p++) {
-          std::string file = "datasets/" + creationNameFichierXML(m_fileNameResults.c_str(), mesh, p, time);
+      for (int p = 0; p < nbParties; p++) {
+          std::string file = "datasets/" + creationNameFichierXML(m_fileNameResults.c_str(), mesh, (m_agrege ? -1 : p), time);
           fileStream << "        <DataSet timestep=\"" << time << "\" part=\"" << p << "\" file=\"" << file.c_str() << "\"/>" << std::endl;
           //fileStream << "        <DataSet timestep=\"" << realTime << "\" part=\"" << p << "\" file=\"" << file.c_str() << "\"/>" << std::endl; //For real-time file name
       }
@@ -353,10 +618,10 @@ void OutputXML::ecritCollectionXML(Mesh *mesh)
     //Creation du file de sortie collection VisIt
     fileStream.open(m_fichierCollectionVisIt.c_str(), std::ios::trunc);
     if (!fileStream) { throw ErrorECOGEN("Impossible d ouvrir le file " + m_fichierCollectionVisIt, __FILE__, __LINE__); }
-    fileStream << "!NBLOCKS " << Ncpu << std::endl;
-    for (int time = 0; time <= m_numFichier; time++) {
-      for (int p = 0; p < Ncpu; p++) {
-          std::string file = "datasets/" + creationNameFichierXML(m_fileNameResults.c_str(), mesh, p, time);
+    fileStream << "!NBLOCKS " << nbParties << std::endl;
+    for (int time = 0; time <= numFichier; time++) {
+      for (int p = 0; p < nbParties; p++) {
+          std::string file = "datasets/" + creationNameFichierXML(m_fileNameResults.c_str(), mesh, (m_agrege ? -1 : p), time);
           fileStream << file.c_str() << std::endl;
       }
     }
@@ -367,166 +632,98 @@ void OutputXML::ecritCollectionXML(Mesh *mesh)
 
 //***********************************************************************
 
-void OutputXML::ecritDonneesPhysiquesXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, std::ofstream &fileStream, bool parallel)
+void OutputXML::prepareDonneesPhysiquesXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, InstantaneXML &instantane)
 {
-  std::vector<double> jeuDonnees;
-
-  std::string prefix;
-  if (parallel) { prefix = "P"; }
-  else { prefix = ""; }
+  std::vector<std::string> &names(instantane.names);
+  std::vector<std::string> variables; //Names of the variables, for the selection of the output profile
+  std::vector<int> vars, phases;
+  listeJeuxDonnees(mesh, names, variables, vars, phases);
+
+  //Profil de sortie : seuls les jeux de donnees selectionnes sont conserves
+  //-----------------------------------------------------------------------
+  if (!m_champs.empty()) {
+    unsigned int nbSelectionnes(0);
+    for (unsigned int d = 0; d < names.size(); d++) {
+      if (!champSelectionne(names[d], variables[d])) continue;
+      names[nbSelectionnes] = names[d]; vars[nbSelectionnes] = vars[d]; phases[nbSelectionnes] = phases[d];
+      nbSelectionnes++;
+    }
+    names.resize(nbSelectionnes); vars.resize(nbSelectionnes); phases.resize(nbSelectionnes);
+  }
 
-  std::string format = "ascii";
-  if (m_ecritBinaire) format = "binary";
+  //Extraction de tous les jeux de donnees en un seul parcours des cells
+  //--------------------------------------------------------------------
+  mesh->recupereDonneesSortie(cellsLvl, vars, phases, instantane.donnees);
+  instantane.typeDonnees = m_typeDonnees;
+  instantane.vectoriels.resize(vars.size());
+  for (unsigned int d = 0; d < vars.size(); d++) { instantane.vectoriels[d] = (vars[d] < 0); }
+
+  //Absolute velocity printing for Moving Reference Frame computations
+  //------------------------------------------------------------------
+  if (m_run->m_MRF!=-1 && champSelectionne("absoluteVelocityMRF", "absoluteVelocityMRF")) {
+    names.push_back("absoluteVelocityMRF");
+    instantane.vectoriels.push_back(true);
+    instantane.donnees.resize(names.size());
+    mesh->extractAbsVeloxityMRF(cellsLvl, instantane.donnees.back(), m_run->m_sources[m_run->m_MRF]);
+  }
+}
 
-  fileStream << "      <" << prefix << "CellData>" << std::endl;
+//***********************************************************************
 
-  //1) Ecriture des variables des phases
-  //------------------------------------
-  for (int phase = 0; phase < m_run->getNumberPhases(); phase++) //For complete output
-  //for (int phase = 0; phase < 1; phase++) //For reduced output
-  {
-    std::string eosName(m_cellRef.getPhase(phase)->getEos()->getName());
-    eosName.erase(eosName.end()-4, eosName.end());
-    //Ecriture des variables scalars
-    for (int var = 1; var <= m_cellRef.getPhase(phase)->getNumberScalars(); var++) {
-      fileStream << "        <" << prefix << "DataArray type=\"Float64\" Name=\"F" << phase << "_" << m_cellRef.getPhase(phase)->returnNameScalar(var) << "_" << eosName << "\"";
-      if (!parallel) {
-        fileStream << " format=\"" << format << "\">" << std::endl;
-        mesh->recupereDonnees(cellsLvl, jeuDonnees, var, phase);
-        this->ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
-        fileStream << std::endl;
-        fileStream << "        </" << prefix << "DataArray>" << std::endl;
-      }
-      else { fileStream << "\"/>" << std::endl; }
-    }
-    //Ecriture des variables vectorielles
-    for (int var = 1; var <= m_cellRef.getPhase(phase)->getNumberVectors(); var++)
-    {
-      fileStream << "        <" << prefix << "DataArray type=\"Float64\" Name=\"F" << phase << "_" << m_cellRef.getPhase(phase)->returnNameVector(var) << "_" << eosName << "\" NumberOfComponents=\"3\"";
-      if (!parallel) {
-        fileStream << " format=\"" << format << "\">" << std::endl;
-        mesh->recupereDonnees(cellsLvl, jeuDonnees, -var, phase);
-        this->ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
-        fileStream << std::endl;
-        fileStream << "        </" << prefix << "DataArray>" << std::endl;
-      }
-      else { fileStream << "\"/>" << std::endl; }
-    }
-  } //Fin phase
-
-  //2) Ecriture des donnees mixture
-  //-------------------------------
-  if (m_run->m_numberPhases > 1)
-  {
-    int mixture = -1;
-    //Ecriture des variables scalars du mixture
-    for (int var = 1; var <= m_cellRef.getMixture()->getNumberScalars(); var++)
-    {
-      fileStream << "        <" << prefix << "DataArray type=\"Float64\" Name=\"" << m_cellRef.getMixture()->returnNameScalar(var) << "\"";
-      if (!parallel) {
-        fileStream << " format=\"" << format << "\">" << std::endl;
-        mesh->recupereDonnees(cellsLvl, jeuDonnees, var, mixture);
-        this->ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
-        fileStream << std::endl;
-        fileStream << "        </" << prefix << "DataArray>" << std::endl;
-      }
-      else { fileStream << "\"/>" << std::endl; }
-    }
-    //Ecriture des variables vectorielles du mixture
-    for (int var = 1; var <= m_cellRef.getMixture()->getNumberVectors(); var++)
-    {
-      fileStream << "        <" << prefix << "DataArray type=\"Float64\" Name=\"" << m_cellRef.getMixture()->returnNameVector(var) << "\" NumberOfComponents=\"3\"";
-      if (!parallel) {
-        fileStream << " format=\"" << format << "\">" << std::endl;
-        mesh->recupereDonnees(cellsLvl, jeuDonnees, -var, mixture);
-        this->ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
-        fileStream << std::endl;
-        fileStream << "        </" << prefix << "DataArray>" << std::endl;
-      }
-      else { fileStream << "\"/>" << std::endl; }
-    }
-  } //Fin mixture
-
-  //3) Ecriture des transports et autres...
-  //---------------------------------------
-  int transport = -2; //For complete output
-  for (int var = 1; var <= m_run->m_numberTransports; var++)
-  {
-    fileStream << "        <" << prefix << "DataArray type=\"Float64\" Name=\"T" << var << "\"";
-    if (!parallel) {
-      fileStream << " format=\"" << format << "\">" << std::endl;
-      mesh->recupereDonnees(cellsLvl, jeuDonnees, var, transport);
-      this->ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
-      fileStream << std::endl;
-      fileStream << "        </" << prefix << "DataArray>" << std::endl;
-    }
-    else { fileStream << "\"/>" << std::endl; }
+bool OutputXML::champSelectionne(const std::string &name, const std::string &variable) const
+{
+  if (m_champs.empty()) return true;
+  for (unsigned int c = 0; c < m_champs.size(); c++) {
+    if (m_champs[c] == name || m_champs[c] == variable) return true;
   }
+  return false;
+}
 
-  //4) Ecriture indicateur xi
-  //-------------------------
-  if (mesh->getType() == AMR) { //For complete output
-    int xi = -3;
-    fileStream << "        <" << prefix << "DataArray type=\"Float64\" Name=\"Xi\"";
-    if (!parallel) {
-      fileStream << " format=\"" << format << "\">" << std::endl;
-      mesh->recupereDonnees(cellsLvl, jeuDonnees, 1, xi);
-      this->ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
-      fileStream << std::endl;
-      fileStream << "        </" << prefix << "DataArray>" << std::endl;
-    }
-    else { fileStream << "\"/>" << std::endl; }
-  }
+//***********************************************************************
 
-  //5) Ecriture gradient rho
-  //------------------------
-  int gradRho = -4;
-  fileStream << "        <" << prefix << "DataArray type=\"Float64\" Name=\"gradRho\"";
-  if (!parallel) {
-    fileStream << " format=\"" << format << "\">" << std::endl;
-    mesh->recupereDonnees(cellsLvl, jeuDonnees, 1, gradRho);
-    this->ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
-    fileStream << std::endl;
-    fileStream << "        </" << prefix << "DataArray>" << std::endl;
+std::string OutputXML::nomTypeVTK(TypeData typeData)
+{
+  switch (typeData) {
+  case DOUBLE:
+    return "Float64";
+  case FLOAT:
+    return "Float32";
+  case INT:
+    return "Int32";
+  case CHAR:
+    return "UInt8";
   }
-  else { fileStream << "\"/>" << std::endl; }
+  return "";
+}
+
+//***********************************************************************
 
-  //6) Absolute velocity printing for Moving Reference Frame computations
-  //---------------------------------------------------------------------
-  if (m_run->m_MRF!=-1) {
-    fileStream << "        <" << prefix << "DataArray type=\"Float64\" Name=\"absoluteVelocityMRF\" NumberOfComponents=\"3\"";
+void OutputXML::ecritDonneesPhysiquesXML(const InstantaneXML &instantane, std::ostream &fileStream, bool parallel)
+{
+  std::string prefix;
+  if (parallel) { prefix = "P"; }
+  else { prefix = ""; }
+
+  fileStream << "      <" << prefix << "CellData>" << std::endl;
+  for (unsigned int d = 0; d < instantane.names.size(); d++) {
+    fileStream << "        <" << prefix << "DataArray type=\"" << nomTypeVTK(instantane.typeDonnees) << "\" Name=\"" << instantane.names[d] << "\"";
+    if (instantane.vectoriels[d]) fileStream << " NumberOfComponents=\"3\"";
     if (!parallel) {
-      fileStream << " format=\"" << format << "\">" << std::endl;
-      mesh->extractAbsVeloxityMRF(cellsLvl, jeuDonnees, m_run->m_sources[m_run->m_MRF]);
-      this->ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
+      fileStream << " " << formatDataArray() << ">" << std::endl;
+      this->ecritJeuDonnees(instantane.donnees[d], fileStream, instantane.typeDonnees);
       fileStream << std::endl;
       fileStream << "        </" << prefix << "DataArray>" << std::endl;
     }
     else { fileStream << "\"/>" << std::endl; }
   }
 
-  //7) CPU rank
-  //-----------
-  // if (mesh->getType() == AMR) { //For complete output
-  //   int CPUrank = -5;
-  //   fileStream << "        <" << prefix << "DataArray type=\"Int32\" Name=\"CPUrank\"";
-  //   if (!parallel) {
-  //     fileStream << " format=\"" << format << "\">" << std::endl;
-  //     mesh->recupereDonnees(cellsLvl, jeuDonnees, 1, CPUrank);
-  //     this->ecritJeuDonnees(jeuDonnees, fileStream, INT);
-  //     fileStream << std::endl;
-  //     fileStream << "        </" << prefix << "DataArray>" << std::endl;
-  //   }
-  //   else { fileStream << "\"/>" << std::endl; }
-  // }
-
-  //8) Morton index
-  //---------------
+  //Morton index
+  //------------
   // if (mesh->getType() == AMR) { //For complete output
   //   int MortonIndex = -6;
   //   fileStream << "        <" << prefix << "DataArray type=\"Int32\" Name=\"MortonIndex\"";
   //   if (!parallel) {
-  //     fileStream << " format=\"" << format << "\">" << std::endl;
+  //     fileStream << " " << formatDataArray() << ">" << std::endl;
   //     mesh->recupereDonnees(cellsLvl, jeuDonnees, 1, MortonIndex);
   //     this->ecritJeuDonnees(jeuDonnees, fileStream, INT);
   //     fileStream << std::endl;
@@ -541,62 +738,63 @@ void OutputXML::ecritDonneesPhysiquesXML(Mesh *mesh, std::vector<Cell *> *cellsL
 
 //***********************************************************************
 
-void OutputXML::ecritMeshRectilinearXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, std::ofstream &fileStream, bool parallel)
+std::string OutputXML::attributsVTKFile() const
 {
-  std::vector<double> jeuDonnees;
+  std::stringstream attributs;
+  attributs << "byte_order=\"";
+  if (!m_ecritBinaire) attributs << "LittleEndian\"";
+  else attributs << m_endianMode.c_str() << "\"";
+  if (m_appendedRaw) attributs << " header_type=\"UInt64\"";
+  if (m_niveauCompression > 0) attributs << " compressor=\"vtkZLibDataCompressor\"";
+  return attributs.str();
+}
 
+//***********************************************************************
+
+void OutputXML::ecritMeshRectilinearXML(Mesh *mesh, const InstantaneXML &instantane, std::ostream &fileStream, bool parallel, bool entete)
+{
   std::string prefix;
   if (parallel) { prefix = "P"; }
   else { prefix = ""; }
   
   //0) Header
   //---------
-  fileStream << "<VTKFile type=\"" << prefix << "RectilinearGrid\" version=\"0.1\" byte_order=\"";
-  if (!m_ecritBinaire) fileStream << "LittleEndian\">" << std::endl;
-  else fileStream << m_endianMode.c_str() << "\">" << std::endl;
-  if (!parallel) {
-    fileStream << "  <RectilinearGrid WholeExtent=\"" << mesh->recupereChaineExtent(rankCpu) << "\">" << std::endl;
-    fileStream << "    <Piece Extent=\"" << mesh->recupereChaineExtent(rankCpu) << "\">" << std::endl;
-  }
-  else {
-    fileStream << "  <PRectilinearGrid WholeExtent = \"" << mesh->recupereChaineExtent(rankCpu, true) << "\" GhostLevel=\"0\">" << std::endl;
+  if (entete) {
+    fileStream << "<VTKFile type=\"" << prefix << "RectilinearGrid\" version=\"0.1\" " << attributsVTKFile() << ">" << std::endl;
+    if (!parallel) { fileStream << "  <RectilinearGrid WholeExtent=\"" << instantane.entete << "\">" << std::endl; }
+    else { fileStream << "  <PRectilinearGrid WholeExtent = \"" << mesh->recupereChaineExtent(rankCpu, true) << "\" GhostLevel=\"0\">" << std::endl; }
   }
+  if (!parallel) { fileStream << "    <Piece Extent=\"" << instantane.entete << "\">" << std::endl; }
   
   //1) Ecriture des Coordonnees des noeuds
   //--------------------------------------
   fileStream << "      <" << prefix << "Coordinates>" << std::endl;
   //Coordonnees en X
-  fileStream << "        <" << prefix << "DataArray type=\"Float64\" ";
+  fileStream << "        <" << prefix << "DataArray type=\"" << nomTypeVTK(instantane.typesMaillage[0]) << "\" ";
   if (!parallel) {
     if (!m_ecritBinaire) { fileStream << "format=\"ascii\">" << std::endl << "          "; }
-    else { fileStream << "format=\"binary\">" << std::endl; }
-    jeuDonnees.clear();
-    mesh->recupereCoord(cellsLvl, jeuDonnees, X);
-    ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
+    else { fileStream << formatDataArray() << ">" << std::endl; }
+    ecritJeuDonnees(instantane.maillage[0], fileStream, instantane.typesMaillage[0]);
     fileStream << std::endl;
     fileStream << "        </" << prefix << "DataArray>" << std::endl;
   }
   else { fileStream << "/>" << std::endl; }
   //Coordonnees en Y
-  fileStream << "        <" << prefix << "DataArray type=\"Float64\" ";
+  fileStream << "        <" << prefix << "DataArray type=\"" << nomTypeVTK(instantane.typesMaillage[1]) << "\" ";
   if (!parallel) {
     if (!m_ecritBinaire) { fileStream << "format=\"ascii\">" << std::endl << "          "; }
-    else { fileStream << "format=\"binary\">" << std::endl; }
-    jeuDonnees.clear();
-    mesh->recupereCoord(cellsLvl, jeuDonnees, Y);
-    ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
+    else { fileStream << formatDataArray() << ">" << std::endl; }
+    ecritJeuDonnees(instantane.maillage[1], fileStream, instantane.typesMaillage[1]);
     fileStream << std::endl;
     fileStream << "        </" << prefix << "DataArray>" << std::endl;
   }
   else { fileStream << "/>" << std::endl; }
   //Coordonnees en Z
-  fileStream << "        <" << prefix << "DataArray type=\"Float64\" ";
+  fileStream << "        <" << prefix << "DataArray type=\"" << nomTypeVTK(instantane.typesMaillage[2]) << "\" ";
   if (!parallel) {
     if (!m_ecritBinaire) { fileStream << "format=\"ascii\">" << std::endl << "          "; }
-    else { fileStream << "format=\"binary\">" << std::endl; }
-    jeuDonnees.clear();
-    mesh->recupereCoord(cellsLvl, jeuDonnees, Z);
-    ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
+    else { fileStream << formatDataArray() << ">" << std::endl; }
+    ecritJeuDonnees(instantane.maillage[2], fileStream, instantane.typesMaillage[2]);
     fileStream << std::endl;
     fileStream << "        </" << prefix << "DataArray>" << std::endl;
   }
@@ -606,38 +804,29 @@ void OutputXML::ecritMeshRectilinearXML(Mesh *mesh, std::vector<Cell *> *cellsLv
 
 //***********************************************************************
 
-void OutputXML::ecritMeshUnstructuredXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, std::ofstream &fileStream, bool parallel)
+void OutputXML::ecritMeshUnstructuredXML(const InstantaneXML &instantane, std::ostream &fileStream, bool parallel, bool entete)
 {
-  std::vector<double> jeuDonnees;
-
   std::string prefix;
   if (parallel) { prefix = "P"; }
   else { prefix = ""; }
 
   //0) Header
   //---------
-  fileStream << "<VTKFile type=\"" << prefix << "UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  if (!m_ecritBinaire) fileStream << "LittleEndian\">" << std::endl;
-  else fileStream << m_endianMode.c_str() << "\">" << std::endl;
-
-  if (parallel) {
-    fileStream << "  <PUnstructuredGrid GhostLevel=\"0\">" << std::endl;
-  }
-  else {
-    fileStream << "  <UnstructuredGrid>" << std::endl;
-    mesh->ecritHeaderPiece(fileStream, cellsLvl);
+  if (entete) {
+    fileStream << "<VTKFile type=\"" << prefix << "UnstructuredGrid\" version=\"0.1\" " << attributsVTKFile() << ">" << std::endl;
+    if (parallel) { fileStream << "  <PUnstructuredGrid GhostLevel=\"0\">" << std::endl; }
+    else { fileStream << "  <UnstructuredGrid>" << std::endl; }
   }
+  if (!parallel) { fileStream << instantane.entete; }
   
   //1) Ecriture des Noeuds
   //----------------------
   fileStream << "      <" << prefix << "Points>" << std::endl;
-  fileStream << "        <" << prefix << "DataArray type=\"Float64\" NumberOfComponents=\"3\" ";
+  fileStream << "        <" << prefix << "DataArray type=\"" << nomTypeVTK(instantane.typesMaillage[0]) << "\" NumberOfComponents=\"3\" ";
   if (!parallel) {
     if (!m_ecritBinaire) { fileStream << "format=\"ascii\">" << std::endl << "          "; }
-    else { fileStream << "format=\"binary\">" << std::endl; }
-    jeuDonnees.clear();
-    mesh->recupereNoeuds(jeuDonnees, cellsLvl);
-    ecritJeuDonnees(jeuDonnees, fileStream, DOUBLE);
+    else { fileStream << formatDataArray() << ">" << std::endl; }
+    ecritJeuDonnees(instantane.maillage[0], fileStream, instantane.typesMaillage[0]);
     fileStream << std::endl;
     fileStream << "        </" << prefix << "DataArray>" << std::endl;
   }
@@ -651,10 +840,8 @@ void OutputXML::ecritMeshUnstructuredXML(Mesh *mesh, std::vector<Cell *> *cellsL
   fileStream << "        <" << prefix << "DataArray type=\"Int32\" Name=\"connectivity\" ";
   if (!parallel) {
     if (!m_ecritBinaire) { fileStream << "format=\"ascii\">" << std::endl << "          "; }
-    else { fileStream << "format=\"binary\">" << std::endl; }
-    jeuDonnees.clear();
-    mesh->recupereConnectivite(jeuDonnees, cellsLvl);
-    ecritJeuDonnees(jeuDonnees, fileStream, INT);
+    else { fileStream << formatDataArray() << ">" << std::endl; }
+    ecritJeuDonnees(instantane.maillage[1], fileStream, INT);
     fileStream << std::endl;
     fileStream << "        </" << prefix << "DataArray>" << std::endl;
   }
@@ -663,10 +850,8 @@ void OutputXML::ecritMeshUnstructuredXML(Mesh *mesh, std::vector<Cell *> *cellsL
   fileStream << "        <" << prefix << "DataArray type=\"Int32\" Name=\"offsets\" ";
   if (!parallel) {
     if (!m_ecritBinaire) { fileStream << "format=\"ascii\">" << std::endl << "          "; }
-    else { fileStream << "format=\"binary\">" << std::endl; }
-    jeuDonnees.clear();
-    mesh->recupereOffsets(jeuDonnees, cellsLvl);
-    ecritJeuDonnees(jeuDonnees, fileStream, INT);
+    else { fileStream << formatDataArray() << ">" << std::endl; }
+    ecritJeuDonnees(instantane.maillage[2], fileStream, INT);
     fileStream << std::endl;
     fileStream << "        </" << prefix << "DataArray>" << std::endl;
   }
@@ -675,10 +860,8 @@ void OutputXML::ecritMeshUnstructuredXML(Mesh *mesh, std::vector<Cell *> *cellsL
   fileStream << "        <" << prefix << "DataArray type=\"UInt8\" Name=\"types\" ";
   if (!parallel) {
     if (!m_ecritBinaire) { fileStream << "format=\"ascii\">" << std::endl << "          "; }
-    else { fileStream << "format=\"binary\">" << std::endl; }
-    jeuDonnees.clear();
-    mesh->recupereTypeCell(jeuDonnees, cellsLvl);
-    ecritJeuDonnees(jeuDonnees, fileStream, CHAR);
+    else { fileStream << formatDataArray() << ">" << std::endl; }
+    ecritJeuDonnees(instantane.maillage[3], fileStream, CHAR);
     fileStream << std::endl;
     fileStream << "        </" << prefix << "DataArray>" << std::endl;
   }
@@ -688,7 +871,7 @@ void OutputXML::ecritMeshUnstructuredXML(Mesh *mesh, std::vector<Cell *> *cellsL
 
 //***********************************************************************
 
-void OutputXML::ecritFinFichierRectilinearXML(std::ofstream &fileStream, bool parallel)
+void OutputXML::ecritFinFichierRectilinearXML(std::ostream &fileStream, bool parallel)
 {
   std::string prefix;
   if (parallel) { prefix = "P"; }
@@ -696,12 +879,13 @@ void OutputXML::ecritFinFichierRectilinearXML(std::ofstream &fileStream, bool pa
 
   if (!parallel) fileStream << "    </Piece>" << std::endl;
   fileStream << "  </" << prefix << "RectilinearGrid>" << std::endl;
+  if (m_appendedRaw && !parallel) ecritAppendedData(fileStream);
   fileStream << "</VTKFile>" << std::endl;
 }
 
 //***********************************************************************
 
-void OutputXML::ecritFinFichierUnstructuredXML(std::ofstream &fileStream, bool parallel)
+void OutputXML::ecritFinFichierUnstructuredXML(std::ostream &fileStream, bool parallel)
 {
   std::string prefix;
   if (parallel) { prefix = "P"; }
@@ -709,6 +893,7 @@ void OutputXML::ecritFinFichierUnstructuredXML(std::ofstream &fileStream, bool p
 
   if (!parallel) fileStream << "    </Piece>" << std::endl;
   fileStream << "  </" << prefix << "UnstructuredGrid>" << std::endl;
+  if (m_appendedRaw && !parallel) ecritAppendedData(fileStream);
   fileStream << "</VTKFile>" << std::endl;
 }
 
@@ -35,8 +35,27 @@
 //! \version   1.0
 //! \date      July 20 2018
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 #include "Output.h"
 
+//! \brief     Snapshot of one results file: everything needed to encode and write it without accessing the mesh nor the cells
+struct InstantaneXML
+{
+  std::string fichier;                                 //!<Path of the results file
+  int numFichier;                                      //!<Number of the results file
+  TypeM typeMesh;                                      //!<Type of the mesh
+  std::string entete;                                  //!<Extent (rectilinear mesh) or piece header (unstructured meshes)
+  std::vector< std::vector<double> > maillage;         //!<Node coordinates in X, Y, Z (rectilinear mesh) or nodes, connectivity, offsets and cell types (unstructured meshes)
+  std::vector<TypeData> typesMaillage;                 //!<Written type of each mesh array
+  std::vector<std::string> names;                      //!<Names of the cell data sets
+  std::vector<bool> vectoriels;                        //!<Cell data sets with 3 components
+  TypeData typeDonnees;                                //!<Written type of the cell data sets
+  std::vector< std::vector<double> > donnees;          //!<Cell data sets (capacity kept between files)
+};
+
 class OutputXML :  public Output
 {
 public:
@@ -48,6 +67,8 @@ public:
   virtual void ecritSolution(Mesh *mesh, std::vector<Cell *> *cellsLvl);
 
   virtual void readResults(Mesh *mesh, std::vector<Cell *> *cellsLvl);
+  //! \brief     Wait for the results files still being written by the asynchronous writer and stop it
+  virtual void termineEcritures();
 
 protected:
 
@@ -55,15 +76,49 @@ protected:
 
   std::string creationNameFichierXML(const char* name, Mesh *mesh=0, int proc=-1, int numFichier=-1, std::string nameVariable ="defaut");
 
-  void ecritSolutionXML(Mesh *mesh, std::vector<Cell *> *cellsLvl);
-  void ecritCollectionXML(Mesh *mesh);
-  void ecritDonneesPhysiquesXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, std::ofstream &fileStream, bool parallel = false);
+  //! \brief     Copy the mesh arrays and the cell data sets of the leaf cells into a snapshot (main thread)
+  void prepareInstantaneXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, InstantaneXML &instantane);
+  void prepareDonneesPhysiquesXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, InstantaneXML &instantane);
+  //! \brief     Check if a cell data set belongs to the output profile (full name or, for phases, name of the variable)
+  bool champSelectionne(const std::string &name, const std::string &variable) const;
+  static std::string nomTypeVTK(TypeData typeData);
+  //! \brief     Attributes of the VTKFile tag of a results file (byte order, header type, compressor)
+  std::string attributsVTKFile() const;
+  //! \brief     Encode and write the results file of a snapshot, and the collections on CPU 0 (main thread or writer thread)
+  void ecritSolutionXML(Mesh *mesh, const InstantaneXML &instantane);
+  void ecritCollectionXML(Mesh *mesh, int numFichier);
+  void ecritDonneesPhysiquesXML(const InstantaneXML &instantane, std::ostream &fileStream, bool parallel = false);
+
+  //! \brief     Write the results file of a snapshot as one piece of a single file shared by all CPUs (collective MPI-IO writes)
+  //! \details   Layout: header, pieces in CPU order, raw appended section made of the data blocks in CPU order
+  void ecritSolutionAgregeeXML(Mesh *mesh, const InstantaneXML &instantane);
+
+  //Dependant du type de mesh (entete = false : piece only, without the VTKFile and grid tags)
+  void ecritMeshRectilinearXML(Mesh *mesh, const InstantaneXML &instantane, std::ostream &fileStream, bool parallel = false, bool entete = true);
+  void ecritMeshUnstructuredXML(const InstantaneXML &instantane, std::ostream &fileStream, bool parallel = false, bool entete = true);
+  void ecritFinFichierRectilinearXML(std::ostream &fileStream, bool parallel = false);
+  void ecritFinFichierUnstructuredXML(std::ostream &fileStream, bool parallel = false);
+
+  //Ecriture asynchrone
+  //! \brief     Free snapshot for the next results file, waiting for the writer if all of them are in flight
+  InstantaneXML* reserveInstantaneXML();
+  //! \brief     Loop of the writer thread: encode and write the queued snapshots in order
+  void boucleEcriture(Mesh *mesh);
+  void verifieEcritures();
 
-  //Dependant du type de mesh
-  void ecritMeshRectilinearXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, std::ofstream &fileStream, bool parallel = false);
-  void ecritMeshUnstructuredXML(Mesh *mesh, std::vector<Cell *> *cellsLvl, std::ofstream &fileStream, bool parallel = false);
-  void ecritFinFichierRectilinearXML(std::ofstream &fileStream, bool parallel = false);
-  void ecritFinFichierUnstructuredXML(std::ofstream &fileStream, bool parallel = false);
+  TypeData m_typeDonnees;                               //!<Written type of the cell data sets and of the node coordinates (DOUBLE or FLOAT)
+  std::vector<std::string> m_champs;                    //!<Output profile: data sets to write (all if empty)
+  bool m_agrege;                                        //!<Single results file per output time shared by all CPUs (MPI-IO)
+  int m_nbAgregateurs;                                  //!<Number of MPI-IO aggregators (cb_nodes hint, 0: MPI-IO default)
+  int m_nbInstantanesAsync;                             //!<Maximal number of snapshots in flight (0: synchronous writing)
+  std::vector<InstantaneXML*> m_instantanes;            //!<Snapshots pool
+  std::deque<InstantaneXML*> m_instantanesLibres;       //!<Snapshots available for the next results file
+  std::deque<InstantaneXML*> m_instantanesAEcrire;      //!<Snapshots queued for the writer thread (the front one is being written)
+  std::thread m_threadEcriture;                         //!<Writer thread (started at the first asynchronous results file)
+  std::mutex m_mutexEcriture;
+  std::condition_variable m_condEcriture;
+  bool m_arretEcriture;                                 //!<Writer thread stops once the queue is empty
+  std::string m_erreurEcriture;                         //!<Error raised in the writer thread, rethrown on the main thread
 
   //Non used / old
   // void ecritFichierParallelXML(Mesh *mesh, std::vector<Cell *> *cellsLvl);
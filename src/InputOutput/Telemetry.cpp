@@ -0,0 +1,137 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      Telemetry.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "Telemetry.h"
+#include "../Parallel/Parallel.h"
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+using namespace tinyxml2;
+
+//***********************************************************************
+
+Telemetry::Telemetry(std::string run, XMLElement *element, std::string fileName) : m_run(run), m_interval(10.), m_progressStart(0.), m_cellUpdatesPrevious(0),
+  m_loadMax(0.), m_loadSum(0.), m_cellsAMR(0.), m_lastOutputTime(-1.)
+{
+  XMLError error(element->QueryDoubleAttribute("interval", &m_interval));
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || m_interval < 0.) throw ErrorXMLAttribut("interval", fileName, __FILE__, __LINE__);
+  const char *file(element->Attribute("file"));
+  if (file != NULL) m_fileName = file;
+}
+
+//***********************************************************************
+
+Telemetry::~Telemetry(){}
+
+//***********************************************************************
+
+void Telemetry::initialize(const std::string &folderOutput, const double &progress, const long long &cellUpdates)
+{
+  if (m_fileName == "") m_fileName = folderOutput + "status.json";
+  m_start = std::chrono::steady_clock::now();
+  m_lastWrite = m_start;
+  m_progressStart = progress;
+  m_cellUpdatesPrevious = cellUpdates;
+}
+
+//***********************************************************************
+
+void Telemetry::computeDt(double &dt, const long long &cellUpdates, const int &nbCellsAMR)
+{
+  //Load of the CPU: leaf cell updates of the time step
+  double load(static_cast<double>(cellUpdates - m_cellUpdatesPrevious));
+  m_cellUpdatesPrevious = cellUpdates;
+  double counters[3] = { load, load, static_cast<double>(nbCellsAMR) };
+  if (Ncpu > 1) { parallel.computeDtTelemetry(dt, counters); }
+  m_loadMax += counters[0];
+  m_loadSum += counters[1];
+  m_cellsAMR = counters[2];
+}
+
+//***********************************************************************
+
+void Telemetry::write(const int &iteration, const double &physicalTime, const double &dt, const double &progress, const bool &finished)
+{
+  if (rankCpu != 0) return;
+  std::chrono::steady_clock::time_point now(std::chrono::steady_clock::now());
+  double sinceWrite(std::chrono::duration<double>(now - m_lastWrite).count());
+  if (!finished && sinceWrite < m_interval) return;
+  double elapsed(std::chrono::duration<double>(now - m_start).count());
+
+  double cellsPerSecond(sinceWrite > 0. ? m_loadSum / sinceWrite : 0.);
+  double imbalance(m_loadSum > 0. ? m_loadMax*Ncpu / m_loadSum : 1.);
+  double eta(-1.);
+  if (finished) { eta = 0.; }
+  else if (progress > m_progressStart) { eta = elapsed*(1. - progress) / (progress - m_progressStart); }
+
+  std::string run;
+  for (unsigned int c = 0; c < m_run.size(); c++) {
+    if (m_run[c] == '"' || m_run[c] == '\\') run += '\\';
+    run += m_run[c];
+  }
+
+  //Written aside then renamed, so that a reader never gets a partial file
+  std::string fileTemp(m_fileName + ".tmp");
+  {
+    std::ofstream fileStream(fileTemp.c_str());
+    fileStream << std::setprecision(12);
+    fileStream << "{" << std::endl;
+    fileStream << "  \"run\": \"" << run << "\"," << std::endl;
+    fileStream << "  \"state\": \"" << (finished ? "finished" : "running") << "\"," << std::endl;
+    fileStream << "  \"iteration\": " << iteration << "," << std::endl;
+    fileStream << "  \"physicalTime\": " << physicalTime << "," << std::endl;
+    fileStream << "  \"dt\": " << dt << "," << std::endl;
+    fileStream << "  \"progress\": " << progress << "," << std::endl;
+    fileStream << "  \"elapsed\": " << elapsed << "," << std::endl;
+    fileStream << "  \"eta\": " << eta << "," << std::endl;
+    fileStream << "  \"cellsPerSecond\": " << cellsPerSecond << "," << std::endl;
+    fileStream << "  \"cellsAMR\": " << static_cast<long long>(m_cellsAMR) << "," << std::endl;
+    fileStream << "  \"imbalance\": " << imbalance << "," << std::endl;
+    fileStream << "  \"lastOutputTime\": " << m_lastOutputTime << "," << std::endl;
+    fileStream << "  \"updated\": " << static_cast<long long>(std::time(0)) << std::endl;
+    fileStream << "}" << std::endl;
+  }
+#ifdef WIN32
+  std::remove(m_fileName.c_str()); //rename does not replace an existing file
+#endif
+  std::rename(fileTemp.c_str(), m_fileName.c_str());
+
+  m_lastWrite = now;
+  m_loadMax = 0.;
+  m_loadSum = 0.;
+}
+
+//***********************************************************************
@@ -0,0 +1,92 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+//! \file      Telemetry.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include <string>
+#include <chrono>
+#include "../libTierces/tinyxml2.h"
+#include "../Errors.h"
+
+//! \class     Telemetry
+//! \brief     Live progress and throughput of the run in a JSON status file, for job monitors
+//! \details   The counters of the CPUs travel with the time step reduction, so the telemetry adds no collective.
+//!            CPU 0 rewrites the status file atomically (temporary file renamed) when the wall-clock interval has elapsed:
+//!            { "run", "state" (running or finished), "iteration", "physicalTime", "dt", "progress", "elapsed" (s),
+//!              "eta" (s, -1 while unknown), "cellsPerSecond" (leaf cell updates of all CPUs, AMR substeps included),
+//!              "cellsAMR" (all CPUs), "imbalance" (maximum over mean load of the CPUs), "lastOutputTime", "updated" (Unix time) }
+//!            Throughput and imbalance are averaged since the previous update of the file.
+class Telemetry
+{
+  public:
+    //! \brief     Telemetry constructor from a XML format reading
+    //! \details   ex: <telemetry interval="10." file="./status.json"/>
+    //!                interval: minimal wall-clock time in seconds between two updates (default 10, 0 for each time step)
+    //!                file: status file (default results/<run>/status.json)
+    //! \param     run              run name (defined in 'mainVX.xml')
+    //! \param     element          XML element of the telemetry
+    //! \param     fileName         string name of readed XML file
+    Telemetry(std::string run, tinyxml2::XMLElement *element, std::string fileName);
+    ~Telemetry();
+
+    //! \brief     Start the clocks of the telemetry
+    //! \param     folderOutput     results folder of the run (default location of the status file)
+    //! \param     progress         progress of the run at the beginning of the time loop (restart), between 0 and 1
+    //! \param     cellUpdates      leaf cell updates already done by the CPU
+    void initialize(const std::string &folderOutput, const double &progress, const long long &cellUpdates);
+    //! \brief     Time step reduction carrying the load and the AMR cells of the CPU (replaces Parallel::computeDt, collective if several CPUs)
+    //! \param     dt               time step of the CPU, minimum over the CPUs on return
+    //! \param     cellUpdates      leaf cell updates done by the CPU since the beginning of the run
+    //! \param     nbCellsAMR       number of AMR cells of the CPU
+    void computeDt(double &dt, const long long &cellUpdates, const int &nbCellsAMR);
+    //! \brief     Record the physical time of the last written results
+    void setLastOutputTime(const double &time) { m_lastOutputTime = time; };
+    //! \brief     Update the status file (CPU 0) if the interval has elapsed or the run is finished
+    void write(const int &iteration, const double &physicalTime, const double &dt, const double &progress, const bool &finished);
+
+  private:
+    std::string m_fileName;                              //!< Status file
+    std::string m_run;                                   //!< Run name
+    double m_interval;                                   //!< Minimal wall-clock time between two updates (s)
+    std::chrono::steady_clock::time_point m_start;       //!< Beginning of the time loop
+    std::chrono::steady_clock::time_point m_lastWrite;   //!< Previous update of the status file
+    double m_progressStart;                              //!< Progress at the beginning of the time loop
+    long long m_cellUpdatesPrevious;                     //!< Leaf cell updates of the CPU at the previous time step
+    double m_loadMax, m_loadSum;                         //!< Sums over the time steps since the previous update of the maximum and total loads
+    double m_cellsAMR;                                   //!< Number of AMR cells of all CPUs at the last time step
+    double m_lastOutputTime;                             //!< Physical time of the last written results (-1: none)
+};
+
+#endif // TELEMETRY_H
@@ -0,0 +1,70 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      CAAlphaGradient.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "CAAlphaGradient.h"
+#include "../../Order1/Cell.h"
+
+using namespace tinyxml2;
+
+static bool registeredAlphaGradient(CriterionAMR::registerCriterion("alphaGradient", &CAAlphaGradient::create));
+
+//***************************************************************
+
+CAAlphaGradient::CAAlphaGradient(XMLElement *element, std::string fileName) : CriterionAMR(element, fileName), m_phase(1)
+{
+  XMLError error(element->QueryIntAttribute("phase", &m_phase));
+  if (error == XML_WRONG_ATTRIBUTE_TYPE || m_phase < 0) throw ErrorXMLAttribut("phase", fileName, __FILE__, __LINE__);
+}
+
+//***************************************************************
+
+CAAlphaGradient::~CAAlphaGradient() {}
+
+//***************************************************************
+
+double CAAlphaGradient::evaluate(const Cell *cellLeft, const Cell *cellRight) const
+{
+  if (cellLeft->getNumberPhases() <= m_phase) { return 0.; }
+  double distance((cellRight->getPosition() - cellLeft->getPosition()).norm());
+  return std::fabs(cellRight->getPhase(m_phase)->getAlpha() - cellLeft->getPhase(m_phase)->getAlpha()) / distance;
+}
+
+//***************************************************************
+
+CriterionAMR* CAAlphaGradient::create(XMLElement *element, std::string fileName)
+{
+  return new CAAlphaGradient(element, fileName);
+}
+
+//***************************************************************
@@ -0,0 +1,69 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      CAVorticity.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "CAVorticity.h"
+#include "../../Order1/Cell.h"
+
+using namespace tinyxml2;
+
+static bool registeredVorticity(CriterionAMR::registerCriterion("vorticity", &CAVorticity::create));
+
+//***************************************************************
+
+CAVorticity::CAVorticity(XMLElement *element, std::string fileName) : CriterionAMR(element, fileName) {}
+
+//***************************************************************
+
+CAVorticity::~CAVorticity() {}
+
+//***************************************************************
+
+double CAVorticity::evaluate(const Cell *cellLeft, const Cell *cellRight) const
+{
+  Coord normal(cellRight->getPosition() - cellLeft->getPosition());
+  double distance(normal.norm());
+  normal /= distance;
+  Coord jumpVelocity(cellRight->getVelocity() - cellLeft->getVelocity());
+  Coord jumpTangential(jumpVelocity - normal * jumpVelocity.scalar(normal));
+  return jumpTangential.norm() / distance;
+}
+
+//***************************************************************
+
+CriterionAMR* CAVorticity::create(XMLElement *element, std::string fileName)
+{
+  return new CAVorticity(element, fileName);
+}
+
+//***************************************************************
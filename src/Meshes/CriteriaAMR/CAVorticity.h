@@ -0,0 +1,56 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CAVORTICITY_H
+#define CAVORTICITY_H
+
+//! \file      CAVorticity.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "CriterionAMR.h"
+
+//! \class     CAVorticity
+//! \brief     Refinement criterion on the vorticity magnitude
+//! \details   Estimated between two neighboring cells from the tangential velocity jump divided by the distance between the cell centers.
+//!            Reading data from XML file under the following format:
+//!             ex :  <criterion name="vorticity" threshold="1.e4"/>   (threshold in s^-1)
+class CAVorticity : public CriterionAMR
+{
+public:
+  CAVorticity(tinyxml2::XMLElement *element, std::string fileName = "Fichier Inconnu");
+  virtual ~CAVorticity();
+
+  virtual double evaluate(const Cell *cellLeft, const Cell *cellRight) const;
+
+  static CriterionAMR* create(tinyxml2::XMLElement *element, std::string fileName);
+};
+
+#endif // CAVORTICITY_H
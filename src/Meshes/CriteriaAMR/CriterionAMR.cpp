@@ -0,0 +1,79 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+//! \file      CriterionAMR.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "CriterionAMR.h"
+
+using namespace tinyxml2;
+
+//***************************************************************
+
+CriterionAMR::CriterionAMR(XMLElement *element, std::string fileName)
+{
+  XMLError error(element->QueryDoubleAttribute("threshold", &m_threshold));
+  if (error != XML_NO_ERROR) throw ErrorXMLAttribut("threshold", fileName, __FILE__, __LINE__);
+}
+
+//***************************************************************
+
+CriterionAMR::~CriterionAMR() {}
+
+//***************************************************************
+
+std::map<std::string, CreatorCriterionAMR>& CriterionAMR::registry()
+{
+  //Function-local map so that registrations from static variables do not depend on the initialization order
+  static std::map<std::string, CreatorCriterionAMR> creators;
+  return creators;
+}
+
+//***************************************************************
+
+bool CriterionAMR::registerCriterion(const std::string &name, CreatorCriterionAMR creator)
+{
+  registry()[name] = creator;
+  return true;
+}
+
+//***************************************************************
+
+CriterionAMR* CriterionAMR::create(XMLElement *element, std::string fileName)
+{
+  const char* name(element->Attribute("name"));
+  if (name == NULL) throw ErrorXMLAttribut("name", fileName, __FILE__, __LINE__);
+  std::map<std::string, CreatorCriterionAMR>::const_iterator it(registry().find(name));
+  if (it == registry().end()) throw ErrorXMLAttribut("name", fileName, __FILE__, __LINE__);
+  return it->second(element, fileName);
+}
+
+//***************************************************************
@@ -0,0 +1,85 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CRITERIONAMR_H
+#define CRITERIONAMR_H
+
+//! \file      CriterionAMR.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include <map>
+#include <string>
+#include "../../libTierces/tinyxml2.h"
+#include "../../Errors.h"
+
+class Cell;
+class CriterionAMR;
+
+//! \brief     Creator of a user-defined refinement criterion from its XML node
+typedef CriterionAMR* (*CreatorCriterionAMR)(tinyxml2::XMLElement *element, std::string fileName);
+
+//! \class     CriterionAMR
+//! \brief     General class for compiled AMR refinement criteria evaluated between two neighboring cells
+//! \details   This is a pure virtual class: can not be instantiated.
+//!            A new criterion is written as a derived class and registered under a name with CriterionAMR::registerCriterion,
+//!            it is then selected in the mesh XML file with: <criterion name="..." threshold="..."/> inside the AMR node.
+class CriterionAMR
+{
+public:
+  //! \brief     Generic criterion constructor from a XML format reading
+  //! \details   Reading data from XML file under the following format:
+  //!             ex :  <criterion name="vorticity" threshold="1.e4"/>
+  //! \param     element        XML element to read for criterion properties
+  //! \param     fileName       String name of readed XML file
+  CriterionAMR(tinyxml2::XMLElement *element, std::string fileName = "Fichier Inconnu");
+  virtual ~CriterionAMR();
+
+  //! \brief     Value of the criterion between two neighboring cells
+  //! \param     cellLeft       Left cell
+  //! \param     cellRight      Right cell
+  virtual double evaluate(const Cell *cellLeft, const Cell *cellRight) const = 0;
+  //! \brief     Return true if both cells must be tagged for refinement (value of the criterion larger than the threshold)
+  bool split(const Cell *cellLeft, const Cell *cellRight) const { return this->evaluate(cellLeft, cellRight) >= m_threshold; };
+
+  //! \brief     Register a criterion creator under the name used in the XML file
+  //! \return    True (allows registration through the initialization of a static variable)
+  static bool registerCriterion(const std::string &name, CreatorCriterionAMR creator);
+  //! \brief     Create the criterion corresponding to the XML node (attribute name)
+  static CriterionAMR* create(tinyxml2::XMLElement *element, std::string fileName = "Fichier Inconnu");
+
+protected:
+  double m_threshold;        //!< Value of the criterion above which the cells are refined
+
+private:
+  static std::map<std::string, CreatorCriterionAMR>& registry();
+};
+
+#endif // CRITERIONAMR_H
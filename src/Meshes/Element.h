@@ -95,6 +95,7 @@ public:
   virtual const double& getSizeY() { Errors::errorMessage("getSizeY not available for requested element"); return Errors::defaultDouble; };
   virtual const double& getSizeZ() { Errors::errorMessage("getSizeZ not available for requested element"); return Errors::defaultDouble; };
   virtual const Coord& getSize() { Errors::errorMessage("getSize not available for requested element"); return Coord::defaultCoord; };
+  virtual std::size_t getMemoryUsage() const { return sizeof(*this); }; //!< Bytes used by the element object (memory accounting)
 
   bool traverseObjet(const GeometricObject &objet) const;
 
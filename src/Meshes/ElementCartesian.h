@@ -57,6 +57,7 @@ public:
   virtual const double& getSizeY() { return m_size.getY(); };
   virtual const double& getSizeZ() { return m_size.getZ(); };
   virtual const Coord& getSize() { return m_size; };
+  virtual std::size_t getMemoryUsage() const { return sizeof(*this) + m_elementsChildren.capacity() * sizeof(ElementCartesian*); };
 
   //Pour methode AMR
   virtual void creerElementChild();
@@ -77,6 +77,7 @@ public:
   virtual const double& getSizeY() { Errors::errorMessage("getSizeY not available for requested face"); return Errors::defaultDouble; };
   virtual const double& getSizeZ() { Errors::errorMessage("getSizeZ not available for requested face"); return Errors::defaultDouble; };
   virtual const Coord& getSize() { Errors::errorMessage("getSize not available for requested face"); return Coord::defaultCoord; };
+  virtual std::size_t getMemoryUsage() const { return sizeof(*this); }; //!< Bytes used by the face object (memory accounting)
 
   //Pour methode AMR
   virtual Face* creerNouvelleFace() { Errors::errorMessage("creerNouvelleFace not available for requested face"); return 0; };
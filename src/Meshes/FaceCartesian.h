@@ -55,6 +55,7 @@ public:
   virtual const double& getSizeY() { return m_size.getY(); };
   virtual const double& getSizeZ() { return m_size.getZ(); };
   virtual const Coord& getSize() { return m_size; };
+  virtual std::size_t getMemoryUsage() const { return sizeof(*this); };
 
   //Pour methode AMR
   virtual Face* creerNouvelleFace();
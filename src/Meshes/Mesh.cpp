@@ -54,6 +54,63 @@ void Mesh::ecritSolutionGnuplot(std::vector<Cell *> *cellsLvl, std::ofstream &fi
   }
 }
 
+//***********************************************************************
+
+void Mesh::recupereCoupes(std::vector<Cell *> *cellsLvl, const std::vector<GeometricObject *> &objets, std::vector< std::vector<double> > &valeurs) const
+{
+  std::vector<int> coupes(objets.size());
+  valeurs.resize(objets.size());
+  for (unsigned int c = 0; c < objets.size(); c++) { coupes[c] = c; valeurs[c].clear(); }
+  for (int i = 0; i < m_numberCellsCalcul; i++) { cellsLvl[0][i]->recupereCoupes(objets, coupes, valeurs); }
+}
+
+void Mesh::recupereDonneesSortie(std::vector<Cell *> *cellsLvl, const std::vector<int> &vars, const std::vector<int> &phases, std::vector< std::vector<double> > &jeuxDonnees) const
+{
+  std::vector<Cell *> cellsSortie;
+  this->recupereCellsSortie(cellsLvl, cellsSortie);
+  this->recupereDonneesCells(cellsSortie, vars, phases, jeuxDonnees);
+}
+
+//***********************************************************************
+
+void Mesh::recupereDonneesCells(const std::vector<Cell *> &cellsSortie, const std::vector<int> &vars, const std::vector<int> &phases, std::vector< std::vector<double> > &jeuxDonnees) const
+{
+  jeuxDonnees.resize(vars.size());
+  for (unsigned int d = 0; d < vars.size(); d++) {
+    if (vars[d] > 0) { jeuxDonnees[d].resize(cellsSortie.size()); }
+    else { jeuxDonnees[d].resize(3 * cellsSortie.size()); }
+  }
+
+  double value(0.);
+  Coord vector;
+  for (unsigned int c = 0; c < cellsSortie.size(); c++) {
+    Cell *cell(cellsSortie[c]);
+    for (unsigned int d = 0; d < vars.size(); d++) {
+      if (vars[d] > 0) { //Scalar data
+        if (phases[d] >= 0) { value = cell->getPhase(phases[d])->returnScalar(vars[d]); }
+        else if (phases[d] == -1) { value = cell->getMixture()->returnScalar(vars[d]); }
+        else if (phases[d] == -2) {
+          value = cell->getTransport(vars[d] - 1).getValue();
+          if (value < 1.e-20) { value = 0.; }
+        }
+        else if (phases[d] == -3) { value = cell->getXi(); }
+        else if (phases[d] == -4) { value = cell->getDensityGradient(); }
+        else if (phases[d] == -5) { value = static_cast<double>(rankCpu); }
+        else { Errors::errorMessage("Mesh::recupereDonneesCells: unknown number of phase: ", phases[d]); }
+        jeuxDonnees[d][c] = value;
+      }
+      else { //Vector data
+        if (phases[d] >= 0) { vector = cell->getPhase(phases[d])->returnVector(-vars[d]); }
+        else if (phases[d] == -1) { vector = cell->getMixture()->returnVector(-vars[d]); }
+        else { Errors::errorMessage("Mesh::recupereDonneesCells: unknown number of phase: ", phases[d]); }
+        jeuxDonnees[d][3 * c] = vector.getX();
+        jeuxDonnees[d][3 * c + 1] = vector.getY();
+        jeuxDonnees[d][3 * c + 2] = vector.getZ();
+      }
+    }
+  }
+}
+
 //****************************************************************************
 //****************************** Parallele ***********************************
 //****************************************************************************
@@ -84,7 +84,11 @@ public:
   //Printing
   //--------
   void ecritSolutionGnuplot(std::vector<Cell *> *cellsLvl, std::ofstream &fileStream, GeometricObject *objet = 0) const;
-  virtual void ecritHeaderPiece(std::ofstream &fileStream, std::vector<Cell *> *cellsLvl) const { Errors::errorMessage("ecritHeaderPiece non prevu pour mesh considere"); };
+  //! \brief     Extracting the rows of several cuts in a single traversal of the computed cells (ghost cells excluded)
+  //! \param     objets           cut objects (lines or planes)
+  //! \param     valeurs          for each cut, rows of the leaf cells crossed (see Cell::recupereCoupes)
+  void recupereCoupes(std::vector<Cell *> *cellsLvl, const std::vector<GeometricObject *> &objets, std::vector< std::vector<double> > &valeurs) const;
+  virtual void ecritHeaderPiece(std::ostream &fileStream, std::vector<Cell *> *cellsLvl) const { Errors::errorMessage("ecritHeaderPiece non prevu pour mesh considere"); };
   virtual std::string recupereChaineExtent(int localRank, bool global = false) const { Errors::errorMessage("recupereChaineExtent non prevu pour mesh considere"); return 0; };
   virtual void recupereCoord(std::vector<Cell *> *cellsLvl, std::vector<double> &jeuDonnees, Axe axe) const { Errors::errorMessage("recupereCoord non prevu pour mesh considere"); };
   virtual void recupereNoeuds(std::vector<double> &jeuDonnees, std::vector<Cell *> *cellsLvl) const { Errors::errorMessage("recupereNoeuds non prevu pour mesh considere"); };
@@ -105,7 +109,22 @@ public:
   //! \param     phase            number of requested phase (-1 for mixture, -2 for transport, -3 for xi, -4 for gradient density mixture)
   //! \param     jeuDonnees       double vector containing the extracted data
   virtual void setDataSet(std::vector<double> &jeuDonnees, std::vector<Cell *> *cellsLvl, const int var, int phase) const { Errors::errorMessage("setDataSet not available for requested mesh"); };
+  //! \brief     Printed cells (leaf cells in the order of the results files)
+  //! \param     cellsLvl         data structure containing pointer to cells
+  //! \param     cellsSortie      vector filled with the printed cells
+  virtual void recupereCellsSortie(std::vector<Cell *> *cellsLvl, std::vector<Cell *> &cellsSortie) const { Errors::errorMessage("recupereCellsSortie not available for requested mesh"); };
+  //! \brief     Extracting every data set of a results file in a single traversal of the printed cells
+  //! \details   Same variable numbering as recupereDonnees, each data set is resized to the number of printed cells (times 3 for vectors) and keeps its capacity between calls
+  //! \param     vars             numbers of the requested variables (>0 for scalar, <0 for vector)
+  //! \param     phases           numbers of the corresponding phases (-1 for mixture, -2 for transport, -3 for xi, -4 for gradient density mixture, -5 for CPU rank)
+  //! \param     jeuxDonnees      one double vector per requested variable
+  void recupereDonneesSortie(std::vector<Cell *> *cellsLvl, const std::vector<int> &vars, const std::vector<int> &phases, std::vector< std::vector<double> > &jeuxDonnees) const;
+  //! \brief     Extracting every data set for the given cells (same numbering and layout as recupereDonneesSortie)
+  void recupereDonneesCells(const std::vector<Cell *> &cells, const std::vector<int> &vars, const std::vector<int> &phases, std::vector< std::vector<double> > &jeuxDonnees) const;
   virtual void refineCellAndCellInterfaces(Cell *cell, const std::vector<AddPhys*> &addPhys, Model *model, int &nbCellsTotalAMR) { Errors::errorMessage("refineCellAndCellInterfaces not available for requested mesh"); };;
+  //! \brief     Refinement/unrefinement of the ghost cells, update of the persistent communications and of the cell/cell-interface arrays of level lvl + 1
+  virtual void updateLvlPlus1(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, TypeMeshContainer<CellInterface *> *cellInterfacesLvl, const int &lvl,
+    const std::vector<AddPhys*> &addPhys, Model *model, Eos **eos) {};
   //! \brief     Extracting absolute velocity for specific Moving Reference Frame computations
   //! \param     cellsLvl         data structure containing pointer to cells
   //! \param     sourceMRF        pointer to the corresponding MRF source
@@ -121,6 +140,17 @@ public:
     const int &numberPhases, const int &numberTransports) { nbCellsTotalAMR = m_numberCellsCalcul; };
   virtual void procedureRaffinement(std::vector<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, std::vector<CellInterface *> *cellInterfacesLvl, const int &lvl,
     const std::vector<AddPhys*> &addPhys, Model *model, int &nbCellsTotalAMR, Eos **eos) {};
+  //! \brief     Remeshing frequency control
+  //! \details   Count the calls of the refinement procedure of level lvl and tell if the current one has to remesh
+  //! \param     lvl              AMR level
+  //! \return    true if the refinement procedure has to be run for this call
+  virtual bool remeshingStep(const int &lvl) { return true; };
+  //! \brief     Adapt the refinement thresholds (and the maximum level) to the global cell budget
+  //! \details   Every budget-control interval, the global number of cells is compared to the target and maximum budgets and each adaptation is logged
+  //! \param     iteration        Current iteration
+  //! \param     nbCellsTotalAMR  Local number of leaf cells
+  //! \param     numTest          Test case number (for logging)
+  virtual void adaptToCellBudget(const int &iteration, const int &nbCellsTotalAMR, const int &numTest) {};
 
 	//Specific for parallel
   //---------------------
@@ -1701,6 +1701,23 @@ void MeshCartesian::recupereCoord(TypeMeshContainer<Cell *> *cellsLvl, std::vect
 
 //****************************************************************************
 
+void MeshCartesian::recupereCellsSortie(TypeMeshContainer<Cell *> *cellsLvl, std::vector<Cell *> &cellsSortie) const
+{
+  cellsSortie.clear();
+  cellsSortie.reserve(m_numberCellsX*m_numberCellsY*m_numberCellsZ);
+  int numCell;
+  for (int k = 0; k < m_numberCellsZ; k++) {
+    for (int j = 0; j < m_numberCellsY; j++) {
+      for (int i = 0; i < m_numberCellsX; i++) {
+        construitIGlobal(i, j, k, numCell);
+        cellsSortie.push_back(cellsLvl[0][numCell]);
+      }
+    }
+  }
+}
+
+//****************************************************************************
+
 void MeshCartesian::recupereDonnees(TypeMeshContainer<Cell *> *cellsLvl, std::vector<double> &jeuDonnees, const int var, int phase) const
 {
   jeuDonnees.clear();
@@ -69,6 +69,7 @@ public:
   virtual std::string recupereChaineExtent(int localRank, bool global = false) const;
   virtual void recupereCoord(TypeMeshContainer<Cell *> *cellsLvl, std::vector<double> &jeuDonnees, Axe axe) const;
   virtual void recupereDonnees(TypeMeshContainer<Cell *> *cellsLvl, std::vector<double> &jeuDonnees, const int var, int phase) const;
+  virtual void recupereCellsSortie(TypeMeshContainer<Cell *> *cellsLvl, std::vector<Cell *> &cellsSortie) const;
   virtual void setDataSet(std::vector<double> &jeuDonnees, TypeMeshContainer<Cell *> *cellsLvl, const int var, int phase) const;
 
 protected:
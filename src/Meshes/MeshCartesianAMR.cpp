@@ -42,16 +42,42 @@
 
 MeshCartesianAMR::MeshCartesianAMR(double lX, int numberCellsX, double lY, int numberCellsY, double lZ, int numberCellsZ,
   std::vector<stretchZone> stretchX, std::vector<stretchZone> stretchY, std::vector<stretchZone> stretchZ,
-	int lvlMax, double criteriaVar, bool varRho, bool varP, bool varU, bool varAlpha, double xiSplit, double xiJoin) :
+	int lvlMax, double criteriaVar, bool varRho, bool varP, bool varU, bool varAlpha, double xiSplit, double xiJoin, std::vector<int> remeshFreq, int xiSmoothingIterations,
+  std::vector<CriterionAMR*> criteria, std::vector<GeometricalDomain*> refinementRegions, std::vector<int> refinementRegionsLvlMax,
+  std::vector< std::vector<bool> > varLvl) :
   MeshCartesian(lX, numberCellsX, lY, numberCellsY, lZ, numberCellsZ, stretchX, stretchY, stretchZ),
-  m_lvlMax(lvlMax), m_criteriaVar(criteriaVar), m_varRho(varRho), m_varP(varP), m_varU(varU), m_varAlpha(varAlpha), m_xiSplit(xiSplit), m_xiJoin(xiJoin)
+  m_lvlMax(lvlMax), m_criteriaVar(criteriaVar), m_varRho(varRho), m_varP(varP), m_varU(varU), m_varAlpha(varAlpha), m_xiSplit(xiSplit), m_xiJoin(xiJoin),
+  m_remeshFreq(remeshFreq), m_xiSmoothingIterations(xiSmoothingIterations), m_criteria(criteria),
+  m_refinementRegions(refinementRegions), m_refinementRegionsLvlMax(refinementRegionsLvlMax),
+  m_cellBudgetTarget(0), m_cellBudgetMax(0), m_cellBudgetFreq(1), m_xiSplitInit(xiSplit), m_xiJoinInit(xiJoin), m_lvlMaxBudget(lvlMax),
+  m_nbCellsBeforeLvlDecrease(0), m_lvlGrowthFactor(2.)
 {
   m_type = AMR;
+  m_remeshFreq.resize(m_lvlMax + 1, 1);
+  m_remeshCounter.assign(m_lvlMax + 1, 0);
+  //Variables used for the refinement of each level (same for all levels if not specified)
+  m_varRhoLvl.assign(m_lvlMax + 1, m_varRho);
+  m_varPLvl.assign(m_lvlMax + 1, m_varP);
+  m_varULvl.assign(m_lvlMax + 1, m_varU);
+  m_varAlphaLvl.assign(m_lvlMax + 1, m_varAlpha);
+  for (unsigned int lvl = 0; lvl < varLvl.size() && lvl <= static_cast<unsigned int>(m_lvlMax); lvl++) {
+    m_varRhoLvl[lvl] = varLvl[lvl][0];
+    m_varPLvl[lvl] = varLvl[lvl][1];
+    m_varULvl[lvl] = varLvl[lvl][2];
+    m_varAlphaLvl[lvl] = varLvl[lvl][3];
+  }
+  //Coarsest level limited by a refinement region (no limitation below)
+  m_lvlMinRegions = m_lvlMax;
+  for (unsigned int r = 0; r < m_refinementRegionsLvlMax.size(); r++) { m_lvlMinRegions = std::min(m_lvlMinRegions, m_refinementRegionsLvlMax[r]); }
 }
 
 //***********************************************************************
 
-MeshCartesianAMR::~MeshCartesianAMR(){}
+MeshCartesianAMR::~MeshCartesianAMR()
+{
+  for (unsigned int c = 0; c < m_criteria.size(); c++) { delete m_criteria[c]; }
+  for (unsigned int r = 0; r < m_refinementRegions.size(); r++) { delete m_refinementRegions[r]; }
+}
 
 //***********************************************************************
 
@@ -522,20 +548,45 @@ void MeshCartesianAMR::procedureRaffinementInitialization(TypeMeshContainer<Cell
   nbCellsTotalAMR = m_numberCellsCalcul;
 
   if (restartSimulation == 0) { //Only for simulation from input files
-    for (int iterInit = 0; iterInit < 2; iterInit++) {
-      for (int lvl = 0; lvl < m_lvlMax; lvl++) {
-        if (Ncpu > 1) { parallel.communicationsPrimitives(eos, lvl); }
-        this->procedureRaffinement(cellsLvl, cellsLvlGhost, cellInterfacesLvl, lvl, addPhys, model, nbCellsTotalAMR, eos);
-        for (unsigned int i = 0; i < cellsLvl[lvl + 1].size(); i++) {
-          cellsLvl[lvl + 1][i]->fill(domains, m_lvlMax);
-        }
-        for (unsigned int i = 0; i < cellsLvl[lvl + 1].size(); i++) {
-          cellsLvl[lvl + 1][i]->completeFulfillState();
-        }
-        for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
-          cellsLvl[lvl][i]->averageChildrenInParent();
-        }
+    std::vector< std::vector<bool> > domainsJump;
+    //The tree is built in one pass per level: Xi is evaluated analytically from the geometrical domains, the cells are only refined
+    //and the new level is directly filled in from the domains
+    for (int lvl = 0; lvl < m_lvlMax; lvl++) {
+      if (Ncpu > 1) { parallel.communicationsPrimitives(eos, lvl); }
+      //Pairs of geometrical domains whose states are separated by a refinement criterion jump (with the variables of this level)
+      this->computeDomainsJump(domains, domainsJump, lvl, numberPhases, numberTransports);
+
+      //1) Xi from the state variations and from the domain indicator sampled inside the cells
+      for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->setToZeroXi(); }
+      for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) {
+        cellInterfacesLvl[lvl][i]->computeXi(m_criteriaVar, m_varRhoLvl[lvl], m_varPLvl[lvl], m_varULvl[lvl], m_varAlphaLvl[lvl], m_criteria);
+      }
+      for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
+        if (cellsLvl[lvl][i]->getXi() < 0.99 && this->domainsJumpInCell(cellsLvl[lvl][i], domains, domainsJump)) { cellsLvl[lvl][i]->setXi(1.); }
+      }
+      if (Ncpu > 1) { parallel.communicationsXi(lvl); }
+
+      //2) Smoothing of Xi and limitation by the refinement regions
+      this->smoothingXi(cellsLvl, cellInterfacesLvl, lvl);
+      this->limitXiLvlMax(cellsLvl, lvl);
+
+      //3) Refinement only (nothing to unrefine during initialization)
+      for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->chooseRefine(m_xiSplit, m_numberCellsY, m_numberCellsZ, addPhys, model, nbCellsTotalAMR); }
+      this->updateLvlPlus1(cellsLvl, cellsLvlGhost, cellInterfacesLvl, lvl, addPhys, model, eos);
+
+      //4) Filling of the new cells from the geometrical domains
+      for (unsigned int i = 0; i < cellsLvl[lvl + 1].size(); i++) {
+        cellsLvl[lvl + 1][i]->fill(domains, m_lvlMax);
       }
+      for (unsigned int i = 0; i < cellsLvl[lvl + 1].size(); i++) {
+        cellsLvl[lvl + 1][i]->completeFulfillState();
+      }
+      for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
+        cellsLvl[lvl][i]->averageChildrenInParent();
+      }
+
+      //5) Load balancing before building the next level, so that the refined region does not stay on a few CPUs
+      if (Ncpu > 1) { this->parallelLoadBalancingAMR(cellsLvl, cellsLvlGhost, cellInterfacesLvl, ordreCalcul, numberPhases, numberTransports, addPhys, model, eos, nbCellsTotalAMR, true); }
     }
     for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
       if (Ncpu > 1) { parallel.communicationsPrimitives(eos, lvl); }
@@ -543,43 +594,105 @@ void MeshCartesianAMR::procedureRaffinementInitialization(TypeMeshContainer<Cell
         if (!cellsLvl[lvl][i]->getSplit()) { cellsLvl[lvl][i]->completeFulfillState(); }
       }
     }
-    if (Ncpu > 1) { this->parallelLoadBalancingAMR(cellsLvl, cellsLvlGhost, cellInterfacesLvl, ordreCalcul, numberPhases, numberTransports, addPhys, model, eos, nbCellsTotalAMR, true); }
   }
 }
 
 //***********************************************************************
 
+void MeshCartesianAMR::computeDomainsJump(std::vector<GeometricalDomain*> &domains, std::vector< std::vector<bool> > &domainsJump, const int &lvl,
+  const int &numberPhases, const int &numberTransports) const
+{
+  //The refinement criterion is applied once between the uniform states of each pair of domains, using the global buffer cells
+  domainsJump.assign(domains.size(), std::vector<bool>(domains.size(), false));
+  CellInterface cellInterface;
+  cellInterface.initialize(cellLeft, cellRight);
+  for (unsigned int d1 = 0; d1 < domains.size(); d1++) {
+    for (unsigned int d2 = d1 + 1; d2 < domains.size(); d2++) {
+      domains[d1]->fillIn(cellLeft, numberPhases, numberTransports);
+      domains[d2]->fillIn(cellRight, numberPhases, numberTransports);
+      cellLeft->fulfillState();
+      cellRight->fulfillState();
+      cellLeft->setToZeroXi();
+      cellRight->setToZeroXi();
+      cellInterface.computeXi(m_criteriaVar, m_varRhoLvl[lvl], m_varPLvl[lvl], m_varULvl[lvl], m_varAlphaLvl[lvl], std::vector<CriterionAMR*>()); //User-defined criteria need the cell geometry
+      domainsJump[d1][d2] = (cellLeft->getXi() > 0.99);
+      domainsJump[d2][d1] = domainsJump[d1][d2];
+    }
+  }
+  if (domains.size()) {
+    domains[0]->fillIn(cellLeft, numberPhases, numberTransports);
+    domains[0]->fillIn(cellRight, numberPhases, numberTransports);
+  }
+}
+
+//***********************************************************************
+
+bool MeshCartesianAMR::domainsJumpInCell(Cell *cell, std::vector<GeometricalDomain*> &domains, const std::vector< std::vector<bool> > &domainsJump) const
+{
+  //Domain indicator (last domain containing the point, as when filling in the cells) sampled on the corners, faces and center of the cell
+  int dimY(0), dimZ(0);
+  if (m_numberCellsY != 1) { dimY = 1; }
+  if (m_numberCellsZ != 1) { dimZ = 1; }
+  const Coord &position(cell->getPosition());
+  double dX(0.5*cell->getElement()->getSizeX()), dY(0.5*cell->getElement()->getSizeY()), dZ(0.5*cell->getElement()->getSizeZ());
+  std::vector<int> indicators; //Distinct indicators already met in the cell
+  Coord point;
+  for (int i = -1; i <= 1; i++) {
+    for (int j = -dimY; j <= dimY; j++) {
+      for (int k = -dimZ; k <= dimZ; k++) {
+        point.setXYZ(position.getX() + i*dX, position.getY() + j*dY, position.getZ() + k*dZ);
+        int indicator(0);
+        for (unsigned int d = 1; d < domains.size(); d++) {
+          if (domains[d]->belong(point, cell->getLvl())) { indicator = d; }
+        }
+        if (std::find(indicators.begin(), indicators.end(), indicator) == indicators.end()) {
+          for (unsigned int n = 0; n < indicators.size(); n++) { if (domainsJump[indicators[n]][indicator]) { return true; } }
+          indicators.push_back(indicator);
+        }
+      }
+    }
+  }
+  return false;
+}
+
+//***********************************************************************
+
 void MeshCartesianAMR::procedureRaffinement(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, TypeMeshContainer<CellInterface *> *cellInterfacesLvl, const int &lvl,
   const std::vector<AddPhys*> &addPhys, Model *model, int &nbCellsTotalAMR, Eos **eos)
 {
   //1) Calcul de Xi dans chaque cell de niveau lvl
   //-------------------------------------------------
   for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->setToZeroXi(); }
-  for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) { cellInterfacesLvl[lvl][i]->computeXi(m_criteriaVar, m_varRho, m_varP, m_varU, m_varAlpha); }
-  // bool varP2 = m_varP;
-  // if (lvl >= 5) { varP2 = false; }
-  // for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) { cellInterfacesLvl[lvl][i]->computeXi(m_criteriaVar, m_varRho, varP2, m_varU, m_varAlpha); }
-  // bool varU2 = m_varU;
-  // if (lvl >= 2) { varU2 = false; }
-  // for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) { cellInterfacesLvl[lvl][i]->computeXi(m_criteriaVar, m_varRho, m_varP, varU2, m_varAlpha); }
-  // for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
-  //  double x(0.), y(0.), z(0.);
-  //  x = cellsLvl[lvl][i]->getPosition().getX();
-  //  y = cellsLvl[lvl][i]->getPosition().getY();
-  //  //z = cellsLvl[lvl][i]->getPosition().getZ();
-  //  //if (std::pow((x*x + y*y + z*z), 0.5) > 500.e-6) {
-  //  //if (std::pow((x*x + y*y), 0.5) > 6.e-4) {
-  //  //if ((x > 250e-6) || (y > 200.e-6)) {
-  //  //if (x > 15.) {
-  //  if (std::pow((x*x + y * y), 0.5) > 5.) {
-  //      cellsLvl[lvl][i]->setToZeroXi();
-  //  }
-  // }
+  for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) {
+    cellInterfacesLvl[lvl][i]->computeXi(m_criteriaVar, m_varRhoLvl[lvl], m_varPLvl[lvl], m_varULvl[lvl], m_varAlphaLvl[lvl], m_criteria);
+  }
   if (Ncpu > 1) { parallel.communicationsXi( lvl); }
   
-  //2) Smoothing de Xi
-  //------------------
-  for (int iterDiff = 0; iterDiff < 2; iterDiff++) { //Arbitrary number of iterations
+  //2) Smoothing de Xi et limitation par les regions de raffinement
+  //---------------------------------------------------------------
+  this->smoothingXi(cellsLvl, cellInterfacesLvl, lvl);
+  this->limitXiLvlMax(cellsLvl, lvl);
+
+	if (lvl < m_lvlMax) {
+    //3) Raffinement des cells et cell interfaces
+    //-------------------------------------------
+    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->chooseRefine(m_xiSplit, m_numberCellsY, m_numberCellsZ, addPhys, model, nbCellsTotalAMR); }
+
+    //4) Deraffinement des cells et cell interfaces
+    //---------------------------------------------
+    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->chooseUnrefine(m_xiJoin, nbCellsTotalAMR); }
+
+    //5) a 7) Cells fantomes, communications persistantes et tableaux de niveau lvl + 1
+    //--------------------------------------------------------------------------------
+    this->updateLvlPlus1(cellsLvl, cellsLvlGhost, cellInterfacesLvl, lvl, addPhys, model, eos);
+  }
+}
+
+//***********************************************************************
+
+void MeshCartesianAMR::smoothingXi(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<CellInterface *> *cellInterfacesLvl, const int &lvl)
+{
+  for (int iterDiff = 0; iterDiff < m_xiSmoothingIterations; iterDiff++) { //Each iteration widens the refinement buffer by one cell
 		//Mise a zero cons xi
     for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->setToZeroConsXi(); }
 
@@ -590,39 +703,115 @@ void MeshCartesianAMR::procedureRaffinement(TypeMeshContainer<Cell *> *cellsLvl,
     for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->timeEvolutionXi(); }
 		if (Ncpu > 1) { parallel.communicationsXi( lvl); }
   }
+}
+
+//***********************************************************************
+
+void MeshCartesianAMR::limitXiLvlMax(TypeMeshContainer<Cell *> *cellsLvl, const int &lvl)
+{
+  if (lvl >= m_lvlMaxBudget) {
+    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->setToZeroXi(); }
+    return;
+  }
+  if (lvl < m_lvlMinRegions) { return; }
+  //The maximum level of a cell is given by the last region containing its center (m_lvlMax outside of all regions).
+  //Xi is cancelled after smoothing so that cells at this level are neither refined nor kept refined (2:1 balance is preserved by chooseRefine/chooseUnrefine).
+  for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
+    Coord position(cellsLvl[lvl][i]->getPosition());
+    int lvlMaxCell(m_lvlMax);
+    for (unsigned int r = 0; r < m_refinementRegions.size(); r++) {
+      if (m_refinementRegions[r]->belong(position, lvl)) { lvlMaxCell = m_refinementRegionsLvlMax[r]; }
+    }
+    if (lvl >= lvlMaxCell) { cellsLvl[lvl][i]->setToZeroXi(); }
+  }
+}
 
-	if (lvl < m_lvlMax) {
-    int lvlPlus1 = lvl + 1;
-    //3) Raffinement des cells et cell interfaces
-    //-------------------------------------------
-    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->chooseRefine(m_xiSplit, m_numberCellsY, m_numberCellsZ, addPhys, model, nbCellsTotalAMR); }
+//***********************************************************************
 
-    //4) Deraffinement des cells et cell interfaces
-    //---------------------------------------------
-    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->chooseUnrefine(m_xiJoin, nbCellsTotalAMR); }
+void MeshCartesianAMR::updateLvlPlus1(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, TypeMeshContainer<CellInterface *> *cellInterfacesLvl, const int &lvl,
+  const std::vector<AddPhys*> &addPhys, Model *model, Eos **eos)
+{
+  int lvlPlus1 = lvl + 1;
+  if (Ncpu > 1) {
+    //5) Raffinement et deraffinement des cells fantomes
+    //-----------------------------------------------------
+    //Communication split + Raffinement et deraffinement des cells fantomes + Reconstruction du tableau de cells fantomes de niveau lvl + 1
+    parallel.communicationsSplit(lvl);
+    cellsLvlGhost[lvlPlus1].clear();
+    for (unsigned int i = 0; i < cellsLvlGhost[lvl].size(); i++) { cellsLvlGhost[lvl][i]->chooseRefineDeraffineGhost(m_numberCellsY, m_numberCellsZ, addPhys, model, cellsLvlGhost); }
+    //Communications primitives pour mettre a jour les cells deraffinees
+    parallel.communicationsPrimitives(eos, lvl);
+
+    //6) Mise a jour des communications persistantes au niveau lvl + 1
+    //----------------------------------------------------------------
+    parallel.communicationsNumberGhostCells(lvlPlus1);	//Communication des numbers d'elements a envoyer et a recevoir de chaque cote de la limite parallele
+    parallel.updatePersistentCommunicationsLvlAMR(lvlPlus1, m_geometrie);
+  }
+
+  //7) Reconstruction des tableaux de cells et cell interfaces lvl + 1
+  //------------------------------------------------------------------
+  cellsLvl[lvlPlus1].clear();
+  cellInterfacesLvl[lvlPlus1].clear();
+  for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->buildLvlCellsAndLvlInternalCellInterfacesArrays(cellsLvl, cellInterfacesLvl); }
+  for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) { cellInterfacesLvl[lvl][i]->constructionTableauCellInterfacesExternesLvl(cellInterfacesLvl); }
+}
+
+//***********************************************************************
 
-    if (Ncpu > 1) {
-      //5) Raffinement et deraffinement des cells fantomes
-      //-----------------------------------------------------
-      //Communication split + Raffinement et deraffinement des cells fantomes + Reconstruction du tableau de cells fantomes de niveau lvl + 1
-      parallel.communicationsSplit(lvl);
-      cellsLvlGhost[lvlPlus1].clear();
-      for (unsigned int i = 0; i < cellsLvlGhost[lvl].size(); i++) { cellsLvlGhost[lvl][i]->chooseRefineDeraffineGhost(m_numberCellsY, m_numberCellsZ, addPhys, model, cellsLvlGhost); }
-      //Communications primitives pour mettre a jour les cells deraffinees
-      parallel.communicationsPrimitives(eos, lvl);
-
-      //6) Mise a jour des communications persistantes au niveau lvl + 1
-      //----------------------------------------------------------------
-      parallel.communicationsNumberGhostCells(lvlPlus1);	//Communication des numbers d'elements a envoyer et a recevoir de chaque cote de la limite parallele
-      parallel.updatePersistentCommunicationsLvlAMR(lvlPlus1, m_geometrie);
+bool MeshCartesianAMR::remeshingStep(const int &lvl)
+{
+  //The counter is identical on every CPU, so all of them take the same decision (communications inside the refinement procedure)
+  bool remesh(m_remeshCounter[lvl] % m_remeshFreq[lvl] == 0);
+  m_remeshCounter[lvl]++;
+  return remesh;
+}
+
+//***********************************************************************
+
+void MeshCartesianAMR::setCellBudget(const int &target, const int &max, const int &freq)
+{
+  m_cellBudgetTarget = target;
+  m_cellBudgetMax = max;
+  m_cellBudgetFreq = freq;
+}
+
+//***********************************************************************
+
+void MeshCartesianAMR::adaptToCellBudget(const int &iteration, const int &nbCellsTotalAMR, const int &numTest)
+{
+  if (m_cellBudgetTarget <= 0 || iteration % m_cellBudgetFreq != 0) { return; }
+  int nbCellsGlobal(nbCellsTotalAMR);
+  if (Ncpu > 1) { parallel.computeNbCellsTotalAMR(nbCellsGlobal); } //Same decision on every CPU
+
+  if (m_nbCellsBeforeLvlDecrease > 0) {
+    m_lvlGrowthFactor = std::max(1., static_cast<double>(m_nbCellsBeforeLvlDecrease) / static_cast<double>(nbCellsGlobal));
+    m_nbCellsBeforeLvlDecrease = 0;
+  }
+
+  double xiSplitOld(m_xiSplit);
+  int lvlMaxOld(m_lvlMaxBudget);
+  double ratio(static_cast<double>(nbCellsGlobal) / static_cast<double>(m_cellBudgetTarget));
+  if (nbCellsGlobal > m_cellBudgetTarget) {
+    //Too many cells: the refinement buffer is first narrowed (higher xi thresholds, at most 1 = tagged cells only),
+    //then the maximum level is decreased when the thresholds can not be raised anymore or when the maximum budget is exceeded
+    bool xiSplitAtMax(m_xiSplit >= 1.);
+    if (!xiSplitAtMax) { m_xiSplit = std::min(1., m_xiSplit * std::min(2., ratio)); }
+    if ((xiSplitAtMax || nbCellsGlobal > m_cellBudgetMax) && m_lvlMaxBudget > 0) {
+      m_lvlMaxBudget--;
+      m_nbCellsBeforeLvlDecrease = nbCellsGlobal;
     }
+  }
+  else if (nbCellsGlobal < 0.8 * m_cellBudgetTarget) {
+    //Budget available again: the maximum level is restored first (if the expected number of cells fits in the target), then the xi thresholds are lowered back to the user values
+    if (m_lvlMaxBudget < m_lvlMax) { if (nbCellsGlobal * m_lvlGrowthFactor < m_cellBudgetTarget) { m_lvlMaxBudget++; } }
+    else if (m_xiSplit > m_xiSplitInit) { m_xiSplit = std::max(m_xiSplitInit, m_xiSplit * std::max(0.5, ratio)); }
+  }
+  if (m_xiSplitInit > 0.) { m_xiJoin = m_xiSplit * m_xiJoinInit / m_xiSplitInit; }
 
-    //7) Reconstruction des tableaux de cells et cell interfaces lvl + 1
-    //------------------------------------------------------------------
-    cellsLvl[lvlPlus1].clear();
-    cellInterfacesLvl[lvlPlus1].clear();
-    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) { cellsLvl[lvl][i]->buildLvlCellsAndLvlInternalCellInterfacesArrays(cellsLvl, cellInterfacesLvl); }
-    for (unsigned int i = 0; i < cellInterfacesLvl[lvl].size(); i++) { cellInterfacesLvl[lvl][i]->constructionTableauCellInterfacesExternesLvl(cellInterfacesLvl); }
+  if (rankCpu == 0 && (m_xiSplit != xiSplitOld || m_lvlMaxBudget != lvlMaxOld)) {
+    std::cout << "T" << numTest << " | AMR cell budget at iteration " << iteration << ": " << nbCellsGlobal << " cells (target " << m_cellBudgetTarget
+      << ", max " << m_cellBudgetMax << ") -> xiSplit " << xiSplitOld << " -> " << m_xiSplit << ", xiJoin " << m_xiJoin
+      << ", lvlMax " << lvlMaxOld << " -> " << m_lvlMaxBudget << std::endl;
   }
 }
 
@@ -637,7 +826,7 @@ std::string MeshCartesianAMR::whoAmI() const
 //******************************** PRINTING ********************************
 //**************************************************************************
 
-void MeshCartesianAMR::ecritHeaderPiece(std::ofstream &fileStream, TypeMeshContainer<Cell *> *cellsLvl) const
+void MeshCartesianAMR::ecritHeaderPiece(std::ostream &fileStream, TypeMeshContainer<Cell *> *cellsLvl) const
 {
   int numberCells = 0, numberPointsParMaille = 4;
   for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
@@ -785,6 +974,18 @@ void MeshCartesianAMR::recupereTypeCell(std::vector<double> &jeuDonnees, std::ve
 
 //***********************************************************************
 
+void MeshCartesianAMR::recupereCellsSortie(TypeMeshContainer<Cell *> *cellsLvl, std::vector<Cell *> &cellsSortie) const
+{
+  cellsSortie.clear();
+  for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
+    for (unsigned int i = 0; i < cellsLvl[lvl].size(); i++) {
+      if (!cellsLvl[lvl][i]->getSplit()) { cellsSortie.push_back(cellsLvl[lvl][i]); }
+    }
+  }
+}
+
+//****************************************************************************
+
 void MeshCartesianAMR::recupereDonnees(TypeMeshContainer<Cell *> *cellsLvl, std::vector<double> &jeuDonnees, const int var, int phase) const
 {
   jeuDonnees.clear();
@@ -995,6 +1196,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell *> *cell
   //Communicate overall loads
   double *loadPerCPU = new double[Ncpu];
   MPI_Allgather(&localLoad, 1, MPI_DOUBLE, loadPerCPU, 1, MPI_DOUBLE, MPI_COMM_WORLD);
+  parallel.compteCommunication(comReduction, 0, rankCpu, sizeof(double));
 
   //Compute ideal load end position
   double idealLoadEndPosition(0.);
@@ -1020,6 +1222,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell *> *cell
   if (rankCpu != Ncpu - 1) {
     MPI_Isend(&idealLoadShiftEnd, 1, MPI_DOUBLE, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu+1, sizeof(double));
   }
   if (rankCpu != 0) {
     MPI_Irecv(&idealLoadShiftStart, 1, MPI_DOUBLE, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
@@ -1051,6 +1254,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell *> *cell
       if (numberOfCellsToSendStart != 0) --numberOfCellsToSendStart;
       MPI_Isend(&numberOfCellsToSendStart, 1, MPI_INT, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
       MPI_Wait(&req_neighborM1, &status);
+      parallel.compteCommunication(comBalancing, 0, rankCpu-1, sizeof(int));
     }
     else {
       //Receive possible load shift start
@@ -1077,6 +1281,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell *> *cell
       if (numberOfCellsToSendEnd != 0) --numberOfCellsToSendEnd;
       MPI_Isend(&numberOfCellsToSendEnd, 1, MPI_INT, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
       MPI_Wait(&req_neighborP1, &status);
+      parallel.compteCommunication(comBalancing, 0, rankCpu+1, sizeof(int));
     }
     else {
       //Receive possible load shift end
@@ -1098,6 +1303,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell *> *cell
   relativePossibleLoadShiftLocal = std::max(std::max(numberOfCellsToSendStart, numberOfCellsToReceiveStart), std::max(numberOfCellsToSendEnd,numberOfCellsToReceiveEnd));
   if (localLoad > 1.e-8) { relativePossibleLoadShiftLocal /= localLoad; }
   MPI_Allreduce(&relativePossibleLoadShiftLocal, &relativePossibleLoadShiftMax, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  parallel.compteCommunication(comReduction, 0, rankCpu, sizeof(double));
 
   if (init) {
     if (relativePossibleLoadShiftMax > 1.e-10) { balance = true; }
@@ -1124,6 +1330,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell *> *cell
     }
     MPI_Isend(&indicesSendStart[0], numberOfCellsToSendStart, MPI_UNSIGNED_LONG_LONG, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
     MPI_Wait(&req_neighborM1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu-1, numberOfCellsToSendStart * sizeof(unsigned long long));
   }
 
   std::vector<typename decomposition::Key<3>::value_type> indicesReceiveEnd(numberOfCellsToReceiveEnd);
@@ -1144,6 +1351,7 @@ void MeshCartesianAMR::computePotentialBalancing(TypeMeshContainer<Cell *> *cell
     }
     MPI_Isend(&indicesSendEnd[0], numberOfCellsToSendEnd, MPI_UNSIGNED_LONG_LONG, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu+1, numberOfCellsToSendEnd * sizeof(unsigned long long));
   }
 
   std::vector<typename decomposition::Key<3>::value_type> indicesReceiveStart(numberOfCellsToReceiveStart);
@@ -1334,8 +1542,10 @@ void MeshCartesianAMR::balance(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshCont
     numberSplitSendStart = dataSplitToSendStart.size();
     MPI_Isend(&numberSendStart, 1, MPI_INT, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
     MPI_Wait(&req_neighborM1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu-1, sizeof(int));
     MPI_Isend(&numberSplitSendStart, 1, MPI_INT, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
     MPI_Wait(&req_neighborM1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu-1, sizeof(int));
   }
   if (numberOfCellsToReceiveEndGlobal > 0) {
     MPI_Irecv(&numberReceiveEnd, 1, MPI_INT, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
@@ -1354,8 +1564,10 @@ void MeshCartesianAMR::balance(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshCont
     numberSplitSendEnd = dataSplitToSendEnd.size();
     MPI_Isend(&numberSendEnd, 1, MPI_INT, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu+1, sizeof(int));
     MPI_Isend(&numberSplitSendEnd, 1, MPI_INT, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu+1, sizeof(int));
   }
   if (numberOfCellsToReceiveStartGlobal > 0) {
     MPI_Irecv(&numberReceiveStart, 1, MPI_INT, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
@@ -1370,8 +1582,10 @@ void MeshCartesianAMR::balance(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshCont
   if (numberOfCellsToSendStartGlobal > 0) {
     MPI_Isend(&dataToSendStart[0], numberSendStart, MPI_DOUBLE, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
     MPI_Wait(&req_neighborM1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu-1, numberSendStart * sizeof(double));
     MPI_Isend(&dataSplitToSendStart[0], numberSplitSendStart, MPI_INT, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
     MPI_Wait(&req_neighborM1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu-1, numberSplitSendStart * sizeof(int));
   }
   if (numberOfCellsToReceiveEndGlobal > 0) {
     MPI_Irecv(&dataToReceiveEnd[0], numberReceiveEnd, MPI_DOUBLE, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
@@ -1389,8 +1603,10 @@ void MeshCartesianAMR::balance(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshCont
   if (numberOfCellsToSendEndGlobal > 0) {
     MPI_Isend(&dataToSendEnd[0], numberSendEnd, MPI_DOUBLE, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu+1, numberSendEnd * sizeof(double));
     MPI_Isend(&dataSplitToSendEnd[0], numberSplitSendEnd, MPI_INT, rankCpu+1, rankCpu+1, MPI_COMM_WORLD, &req_neighborP1);
     MPI_Wait(&req_neighborP1, &status);
+    parallel.compteCommunication(comBalancing, 0, rankCpu+1, numberSplitSendEnd * sizeof(int));
   }
   if (numberOfCellsToReceiveStartGlobal > 0) {
     MPI_Irecv(&dataToReceiveStart[0], numberReceiveStart, MPI_DOUBLE, rankCpu-1, rankCpu, MPI_COMM_WORLD, &req_neighborM1);
@@ -36,6 +36,7 @@
 //! \date      June 5 2019
 
 #include "MeshCartesian.h"
+#include "CriteriaAMR/HeaderCriterionAMR.h"
 
 class MeshCartesianAMR : public MeshCartesian
 {
@@ -43,7 +44,9 @@ public:
   MeshCartesianAMR(double lX, int numberCellsX, double lY, int numberCellsY, double lZ, int numberCellsZ,
     std::vector<stretchZone> stretchX, std::vector<stretchZone> stretchY, std::vector<stretchZone> stretchZ,
 		int lvlMax = 0, double criteriaVar = 1.e10, bool varRho = false, bool varP = false, bool varU = false, 
-    bool varAlpha = false, double xiSplit = 1., double xiJoin = 1.);
+    bool varAlpha = false, double xiSplit = 1., double xiJoin = 1., std::vector<int> remeshFreq = std::vector<int>(), int xiSmoothingIterations = 2,
+    std::vector<CriterionAMR*> criteria = std::vector<CriterionAMR*>(), std::vector<GeometricalDomain*> refinementRegions = std::vector<GeometricalDomain*>(),
+    std::vector<int> refinementRegionsLvlMax = std::vector<int>(), std::vector< std::vector<bool> > varLvl = std::vector< std::vector<bool> >());
   virtual ~MeshCartesianAMR();
 
   virtual int initializeGeometrie(TypeMeshContainer<Cell *> &cells, TypeMeshContainer<Cell *> &cellsGhost, TypeMeshContainer<CellInterface *> &cellInterfaces,
@@ -56,17 +59,27 @@ public:
 		Eos **eos, const int &restartSimulation, std::string ordreCalcul, const int &numberPhases, const int &numberTransports);
   virtual void procedureRaffinement(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, TypeMeshContainer<CellInterface *> *cellInterfacesLvl, const int &lvl,
     const std::vector<AddPhys*> &addPhys, Model *model, int &nbCellsTotalAMR, Eos **eos);
+  virtual bool remeshingStep(const int &lvl);
+  virtual void adaptToCellBudget(const int &iteration, const int &nbCellsTotalAMR, const int &numTest);
+  //! \brief     Set the global cell budget
+  //! \param     target           Target number of cells (the refinement is relaxed again below 80% of it)
+  //! \param     max              Maximum number of cells (the maximum level is decreased above it)
+  //! \param     freq             Budget-control interval (in iterations)
+  void setCellBudget(const int &target, const int &max, const int &freq);
   virtual std::string whoAmI() const;
 
   //Printing / Reading
-  virtual void ecritHeaderPiece(std::ofstream &fileStream, TypeMeshContainer<Cell *> *cellsLvl) const;
+  virtual void ecritHeaderPiece(std::ostream &fileStream, TypeMeshContainer<Cell *> *cellsLvl) const;
   virtual void recupereNoeuds(std::vector<double> &jeuDonnees, std::vector<Cell *> *cellsLvl) const;
   virtual void recupereConnectivite(std::vector<double> &jeuDonnees, std::vector<Cell *> *cellsLvl) const;
   virtual void recupereOffsets(std::vector<double> &jeuDonnees, std::vector<Cell *> *cellsLvl) const;
   virtual void recupereTypeCell(std::vector<double> &jeuDonnees, std::vector<Cell *> *cellsLvl) const;
   virtual void recupereDonnees(TypeMeshContainer<Cell *> *cellsLvl, std::vector<double> &jeuDonnees, const int var, int phase) const;
+  virtual void recupereCellsSortie(TypeMeshContainer<Cell *> *cellsLvl, std::vector<Cell *> &cellsSortie) const;
   virtual void setDataSet(std::vector<double> &jeuDonnees, TypeMeshContainer<Cell *> *cellsLvl, const int var, int phase) const;
   virtual void refineCellAndCellInterfaces(Cell *cell, const std::vector<AddPhys*> &addPhys, Model *model, int &nbCellsTotalAMR);
+  virtual void updateLvlPlus1(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<Cell *> *cellsLvlGhost, TypeMeshContainer<CellInterface *> *cellInterfacesLvl, const int &lvl,
+    const std::vector<AddPhys*> &addPhys, Model *model, Eos **eos);
   virtual void printDomainDecomposition(std::ofstream &fileStream);
   virtual void readDomainDecomposition(std::ifstream &fileStream);
 
@@ -91,8 +104,33 @@ private:
 	double m_criteriaVar;                       //!<Valeur du criteria a depasser sur la variation d'une variable pour le (de)raffinement (met xi=1.)
 	bool m_varRho, m_varP, m_varU, m_varAlpha;  //!<Choix sur quelle variation on (de)raffine
 	double m_xiSplit, m_xiJoin;                 //!<Valeur de xi pour split ou join les mailles
+  std::vector<int> m_remeshFreq;              //!<Remeshing interval of each level (number of calls of the refinement procedure between two remeshings)
+  std::vector<int> m_remeshCounter;           //!<Number of calls of the refinement procedure of each level since the beginning of the time loop
+  int m_xiSmoothingIterations;                //!<Number of Xi smoothing iterations (width of the refinement buffer around detected features)
+  std::vector<CriterionAMR*> m_criteria;      //!<User-defined compiled refinement criteria (owned by the mesh)
+  std::vector<GeometricalDomain*> m_refinementRegions; //!<Regions limiting the refinement, only their shape is used (owned by the mesh)
+  std::vector<int> m_refinementRegionsLvlMax; //!<Maximum level of each refinement region
+  int m_lvlMinRegions;                        //!<Smallest maximum level of the refinement regions (no limitation on coarser levels)
+  std::vector<bool> m_varRhoLvl, m_varPLvl, m_varULvl, m_varAlphaLvl; //!<Variables used for the refinement of each level
+  int m_cellBudgetTarget, m_cellBudgetMax;    //!<Target and maximum global numbers of cells (no budget control if m_cellBudgetTarget = 0)
+  int m_cellBudgetFreq;                       //!<Budget-control interval (in iterations)
+  double m_xiSplitInit, m_xiJoinInit;         //!<Values of xi for split or join given by the user (lower bounds of the adaptation)
+  int m_lvlMaxBudget;                         //!<Maximum level currently allowed by the cell budget
+  int m_nbCellsBeforeLvlDecrease;             //!<Global number of cells when the maximum level was last decreased (0 once its effect is measured)
+  double m_lvlGrowthFactor;                   //!<Measured ratio of numbers of cells before/after a decrease of the maximum level (to restore it without oscillations)
   decomposition::Decomposition m_decomp;      //!<Parallel domain decomposition based on keys
 
+  //! \brief     Smoothing of Xi on level lvl (widens the refinement buffer by one cell per iteration)
+  void smoothingXi(TypeMeshContainer<Cell *> *cellsLvl, TypeMeshContainer<CellInterface *> *cellInterfacesLvl, const int &lvl);
+  //! \brief     Cancel Xi of the cells of level lvl which have reached the maximum level of their refinement region or of the cell budget
+  void limitXiLvlMax(TypeMeshContainer<Cell *> *cellsLvl, const int &lvl);
+  //! \brief     Determine which pairs of geometrical domains are separated by a jump of the refinement criterion
+  //! \param     domainsJump       Symmetric matrix, true if the refinement criterion is reached between the states of both domains
+  void computeDomainsJump(std::vector<GeometricalDomain*> &domains, std::vector< std::vector<bool> > &domainsJump, const int &lvl, const int &numberPhases, const int &numberTransports) const;
+  //! \brief     Analytical refinement indicator: true if the cell overlaps two geometrical domains separated by a criterion jump
+  //! \details   The domain indicator is sampled on the center, the face centers and the corners of the cell
+  bool domainsJumpInCell(Cell *cell, std::vector<GeometricalDomain*> &domains, const std::vector< std::vector<bool> > &domainsJump) const;
+
 };
 
 #endif // MESHCARTESIANAMR_H
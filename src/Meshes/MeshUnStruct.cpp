@@ -1744,7 +1744,7 @@ void MeshUnStruct::lectureElementGmshV4(const Coord *TableauNoeuds, std::ifstrea
 //******************************** ECRITURE ********************************
 //**************************************************************************
 
-void MeshUnStruct::ecritHeaderPiece(std::ofstream &fileStream, TypeMeshContainer<Cell *> *cellsLvl) const
+void MeshUnStruct::ecritHeaderPiece(std::ostream &fileStream, TypeMeshContainer<Cell *> *cellsLvl) const
 {
   fileStream << "    <Piece NumberOfPoints=\"" << m_numberNoeuds << "\" NumberOfCells=\"" << m_numberCellsCalcul - m_numberCellsFantomes << "\">" << std::endl;
 }
@@ -1807,6 +1807,16 @@ void MeshUnStruct::recupereTypeCell(std::vector<double> &jeuDonnees, std::vector
 
 //****************************************************************************
 
+void MeshUnStruct::recupereCellsSortie(TypeMeshContainer<Cell *> *cellsLvl, std::vector<Cell *> &cellsSortie) const
+{
+  cellsSortie.clear();
+  for (int i = m_numberFacesLimites; i < m_numberElementsInternes; i++) {
+    if (!m_elements[i]->isFantome()) { cellsSortie.push_back(cellsLvl[0][m_elements[i]->getNumCellAssociee()]); }
+  }
+}
+
+//****************************************************************************
+
 void MeshUnStruct::recupereDonnees(TypeMeshContainer<Cell *> *cellsLvl, std::vector<double> &jeuDonnees, const int var, int phase) const
 {
   jeuDonnees.clear();
@@ -36,7 +36,7 @@
 
 //***********************************************************************
 
-ElementNS::ElementNS(){}
+ElementNS::ElementNS() : m_CPU(0), m_numberautresCPU(0), m_autresCPU(0), m_numNoeuds(0) {}
 
 //***********************************************************************
 
@@ -46,7 +46,10 @@ m_numberNoeuds(numberNoeuds),
 m_numberFaces(numberFaces),
 m_typeVTK(typeVTK),
 m_isFantome(false),
-m_isCommunicant(false)
+m_isCommunicant(false),
+m_CPU(0),
+m_numberautresCPU(0),
+m_autresCPU(0)
 {
   m_numNoeuds = new int[numberNoeuds];
 }
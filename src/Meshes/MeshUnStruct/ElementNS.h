@@ -77,6 +77,7 @@ public:
   const int& getAppartenanceGeometrique() const { return m_appartenanceGeometrique; };
   const int& getCPU() const { return m_CPU; };
   const int& getNumberAutresCPU() const { return m_numberautresCPU; };
+  virtual std::size_t getMemoryUsage() const { return sizeof(*this) + (m_numberNoeuds + m_numberautresCPU) * sizeof(int); };
   const int& getAutreCPU(const int &autreCPU) const;
   void printInfo() const;
 
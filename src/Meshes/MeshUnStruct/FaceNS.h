@@ -64,6 +64,7 @@ public:
   const int& getNumNoeud(const int &numNoeud) const { return m_numNoeuds[numNoeud]; };
   void getInfoNoeuds(int *numNoeuds, int &sommeNumNoeuds) const;
   const bool& getEstLimite() const { return m_limite; };
+  virtual std::size_t getMemoryUsage() const { return sizeof(*this) + m_numberNoeuds * sizeof(int); };
   void afficheNoeuds() const;
   virtual void printInfo() const;
   static int rechercheFace(int *face, int &sommeNoeuds, int **tableauFaces, int *tableauSommeNoeuds, int numberNoeuds, int &indexMaxFaces); // Recherche si face appartient au tableau tableauFaces : renvoi le number ou -1 si absence
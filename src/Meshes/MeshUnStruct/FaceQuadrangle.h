@@ -42,6 +42,7 @@ class FaceQuadrangle : public FaceNS
 public:
   FaceQuadrangle(const int &numNoeud1, const int &numNoeud2, const int &numNoeud3, const int &numNoeud4, int tri=1);
   virtual ~FaceQuadrangle();
+  virtual std::size_t getMemoryUsage() const { return FaceNS::getMemoryUsage() + sizeof(*this) - sizeof(FaceNS) + NOMBRENOEUDS * sizeof(int); };
 
 private:
   virtual void computeSurface(const Coord *noeuds);
@@ -69,6 +69,7 @@ class FluxEuler : public Flux
     virtual const Coord& getQdm() const { return m_qdm; };
     virtual const double& getMasseMix() const { return m_masse; }; 
     virtual const double& getEnergyMix() const { return m_energ; };
+    virtual std::size_t getMemoryUsage(const int &numberPhases) const { return sizeof(*this); };
     virtual void setCons(const Flux *cons, const int &numberPhases);
 
   protected:
@@ -103,6 +103,7 @@ class MixEuler : public Mixture
       virtual const double& getTotalEnergy() const { return Errors::defaultDouble; };
       virtual const double& getFrozenSoundSpeed() const { return Errors::defaultDouble; };
       virtual const double& getWoodSoundSpeed() const { return Errors::defaultDouble; };
+      virtual std::size_t getMemoryUsage() const { return sizeof(*this); };
 
       virtual void setPressure(const double &p) {};
       virtual void setVelocity(const double &u, const double &v, const double &w) {};
@@ -117,6 +117,7 @@ public:
   virtual const double& getEnergy() const { return m_energie; };
   virtual const double& getTotalEnergy() const { return m_totalEnergy; };
   virtual const double& getMixSoundSpeed() const { return m_EqSoundSpeed; };
+  virtual std::size_t getMemoryUsage() const { return sizeof(*this); };
 
   virtual void setPressure(const double &p);
   virtual void setTemperature(const double &T);
@@ -123,6 +123,9 @@ class Flux
     virtual const Coord& getQdm() const { return Coord::defaultCoord; };
     virtual const double& getMasseMix() const { return Errors::defaultDouble; };
     virtual const double& getEnergyMix() const { return Errors::defaultDouble; };
+    //! \brief     Return the bytes used by the flux object and its arrays (memory accounting)
+    //! \param     numberPhases   number of phases
+    virtual std::size_t getMemoryUsage(const int &numberPhases) const { return sizeof(*this); };
     virtual void setCons(const Flux *cons, const int &numberPhases) { Errors::errorMessage("setCons not available for required model"); };
 
   protected:
@@ -76,6 +76,7 @@ class FluxKapila : public Flux
     virtual const double& getEnergy(const int &numPhase) const { return m_energ[numPhase]; };
     virtual const Coord& getQdm() const { return m_qdm; };
     virtual const double& getEnergyMix() const { return m_energMixture; };
+    virtual std::size_t getMemoryUsage(const int &numberPhases) const { return sizeof(*this) + 3 * numberPhases * sizeof(double); };
     virtual void setCons(const Flux *cons, const int &numberPhases);
 
 protected:
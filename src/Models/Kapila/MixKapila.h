@@ -111,6 +111,7 @@ class MixKapila : public Mixture
       virtual const double& getTotalEnergy() const { return m_totalEnergy; };
       virtual const double& getFrozenSoundSpeed() const { return m_frozenSoundSpeed; };
       virtual const double& getWoodSoundSpeed() const { return m_woodSoundSpeed; };
+      virtual std::size_t getMemoryUsage() const { return sizeof(*this); };
 
       virtual void setPressure(const double &p);
       virtual void setVelocity(const double &u, const double &v, const double &w);
@@ -116,6 +116,7 @@ class PhaseKapila : public Phase
     virtual const double& getEnergy() const { return m_energie; };
     virtual const double& getSoundSpeed() const { return m_soundSpeed; };
     virtual double getTemperature() const { return m_eos->computeTemperature(m_density, m_pressure); };
+    virtual std::size_t getMemoryUsage() const { return sizeof(*this); };
 
     virtual void setAlpha(double alpha);
     virtual void setDensity(double density);
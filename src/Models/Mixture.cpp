@@ -44,7 +44,7 @@ Mixture::~Mixture(){}
 
 //***************************************************************************
 
-void Mixture::printMixture(std::ofstream &fileStream) const
+void Mixture::printMixture(std::ostream &fileStream) const
 {
   //Scalar variables
   for (int var = 1; var <= this->getNumberScalars(); var++) {
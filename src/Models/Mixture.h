@@ -50,7 +50,7 @@ class Mixture
       virtual ~Mixture();
       //! \brief     Print mixture variables in file stream
       //! \param     fileStream      file stream to write in
-      void printMixture(std::ofstream &fileStream) const;
+      void printMixture(std::ostream &fileStream) const;
 
       //! \brief     Compute saturation temperature for a liq/vapor couple of fluid at given pressure
       //! \param     eosLiq             pointer to equation of state of liquid phase
@@ -192,6 +192,7 @@ class Mixture
       virtual const double& getFrozenSoundSpeed() const { Errors::errorMessage("getFrozenSoundSpeed not available for required mixture"); return Errors::defaultDouble; };
       virtual const double& getWoodSoundSpeed() const { Errors::errorMessage("getWoodSoundSpeed not available for required mixture"); return Errors::defaultDouble; };
       virtual const double& getMixSoundSpeed() const { Errors::errorMessage("getMixSoundSpeed not available for required mixture"); return Errors::defaultDouble; };
+      virtual std::size_t getMemoryUsage() const { return sizeof(*this); }; //!< Bytes used by the mixture object (memory accounting)
 
       virtual void setPressure(const double &p) { Errors::errorMessage("setPressure non implemente pour mixture utilise"); };
       virtual void setTemperature(const double &T) { Errors::errorMessage("setTemperature non implemente pour mixture utilise"); }
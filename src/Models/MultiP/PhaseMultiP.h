@@ -116,6 +116,7 @@ class PhaseMultiP : public Phase
     virtual const double& getSoundSpeed() const { return m_soundSpeed; };
     virtual const double& getTotalEnergy() const { return m_totalEnergy; };
     virtual double getTemperature() const { return m_eos->computeTemperature(m_density, m_pressure); };
+    virtual std::size_t getMemoryUsage() const { return sizeof(*this); };
 
     virtual void setAlpha(double alpha);
     virtual void setDensity(double density);
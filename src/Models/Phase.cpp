@@ -44,7 +44,7 @@ Phase::~Phase(){}
 
 //***************************************************************************
 
-void Phase::printPhase(std::ofstream &fileStream) const
+void Phase::printPhase(std::ostream &fileStream) const
 {
   //Scalar variables
   for (int var = 1; var <= this->getNumberScalars(); var++) {
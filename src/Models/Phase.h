@@ -54,7 +54,7 @@ class Phase
     virtual ~Phase();
     //! \brief     Print phase variables in file stream
     //! \param     fileStream      file stream to write in
-    void printPhase(std::ofstream &fileStream) const;
+    void printPhase(std::ostream &fileStream) const;
     //! \brief     Copy phase attributes in phase
     //! \param     vecPhase      destination phase variable 
     virtual void allocateAndCopyPhase(Phase **vecPhase) { Errors::errorMessage("allocateAndCopyPhase not available for requested phase type"); };
@@ -127,6 +127,7 @@ class Phase
     virtual const double& getSoundSpeed() const { Errors::errorMessage("getSoundSpeed impossible avec type de phase demande"); return Errors::defaultDouble; };
     virtual const double& getTotalEnergy() const { Errors::errorMessage("getTotalEnergy impossible avec type de phase demande"); return Errors::defaultDouble; };
     virtual double getTemperature() const { Errors::errorMessage("getT impossible avec type de phase demande"); return 0.; };
+    virtual std::size_t getMemoryUsage() const { return sizeof(*this); }; //!< Bytes used by the phase object (memory accounting)
 
     virtual void setAlpha(double alpha) { Errors::errorMessage("setAlpha not available for requested phase type"); };
     virtual void setDensity(double density) { Errors::errorMessage("setDensity not available for requested phase type"); };
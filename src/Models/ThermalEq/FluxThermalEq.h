@@ -70,6 +70,7 @@ class FluxThermalEq : public Flux
     virtual const double& getMasse(const int &numPhase) const { return m_masse[numPhase]; };
     virtual const Coord& getQdm() const { return m_qdm; };
     virtual const double& getEnergyMix() const { return m_energMixture; };
+    virtual std::size_t getMemoryUsage(const int &numberPhases) const { return sizeof(*this) + numberPhases * sizeof(double); };
     virtual void setCons(const Flux *cons, const int &numberPhases);
 
 protected:
@@ -118,6 +118,7 @@ class MixThermalEq : public Mixture
       virtual const double& getEnergy() const { return m_energie; };
       virtual const double& getTotalEnergy() const { return m_totalEnergy; };
       virtual const double& getMixSoundSpeed() const { return m_thermalEqSoundSpeed; };
+      virtual std::size_t getMemoryUsage() const { return sizeof(*this); };
 
       virtual void setPressure(const double &p);
       virtual void setVelocity(const double &u, const double &v, const double &w);
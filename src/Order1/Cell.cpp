@@ -278,7 +278,7 @@ void Cell::correctionEnergy(const int &numberPhases)
 
 //***********************************************************************
 
-void Cell::printPhasesMixture(const int &numberPhases, const int &numberTransports, std::ofstream &fileStream) const
+void Cell::printPhasesMixture(const int &numberPhases, const int &numberTransports, std::ostream &fileStream) const
 {
   for (int k = 0; k < numberPhases; k++) { m_vecPhases[k]->printPhase(fileStream); }
   m_mixture->printMixture(fileStream);
@@ -1524,7 +1524,7 @@ void Cell::buildLvlCellsAndLvlInternalCellInterfacesArrays(std::vector<Cell *> *
 
 //***********************************************************************
 
-bool Cell::printGnuplotAMR(std::ofstream &fileStream, const int &dim, GeometricObject *objet)
+bool Cell::printGnuplotAMR(std::ostream &fileStream, const int &dim, GeometricObject *objet)
 {
   bool ecrit(true);
   int dimension(dim);
@@ -1561,6 +1561,42 @@ bool Cell::printGnuplotAMR(std::ofstream &fileStream, const int &dim, GeometricO
 
 //***********************************************************************
 
+void Cell::recupereCoupes(const std::vector<GeometricObject *> &objets, const std::vector<int> &coupes, std::vector< std::vector<double> > &valeurs) const
+{
+  std::vector<int> coupesTraversees;
+  for (unsigned int c = 0; c < coupes.size(); c++) {
+    if (m_element->traverseObjet(*objets[coupes[c]])) coupesTraversees.push_back(coupes[c]);
+  }
+  if (coupesTraversees.empty()) return;
+
+  if (m_split) {
+    for (unsigned int i = 0; i < m_childrenCells.size(); i++) {
+      m_childrenCells[i]->recupereCoupes(objets, coupesTraversees, valeurs);
+    }
+    return;
+  }
+  //Same columns as printGnuplotAMR
+  for (unsigned int c = 0; c < coupesTraversees.size(); c++) {
+    std::vector<double> &ligne(valeurs[coupesTraversees[c]]);
+    GeometricObject *objet(objets[coupesTraversees[c]]);
+    Coord position = objet->projectionPoint(m_element->getPosition());
+    if (objet->getType() >= 1) ligne.push_back(position.getX());
+    if (objet->getType() >= 2) ligne.push_back(position.getY());
+    if (objet->getType() == 3) ligne.push_back(position.getZ());
+    for (int k = 0; k < m_numberPhases; k++) {
+      for (int var = 1; var <= m_vecPhases[k]->getNumberScalars(); var++) { ligne.push_back(m_vecPhases[k]->returnScalar(var)); }
+      for (int var = 1; var <= m_vecPhases[k]->getNumberVectors(); var++) { ligne.push_back(m_vecPhases[k]->returnVector(var).norm()); }
+    }
+    for (int var = 1; var <= m_mixture->getNumberScalars(); var++) { ligne.push_back(m_mixture->returnScalar(var)); }
+    for (int var = 1; var <= m_mixture->getNumberVectors(); var++) { ligne.push_back(m_mixture->returnVector(var).norm()); }
+    for (int k = 0; k < m_numberTransports; k++) { ligne.push_back(m_vecTransports[k].getValue()); }
+    ligne.push_back(m_lvl);
+    ligne.push_back(m_xi);
+  }
+}
+
+//***********************************************************************
+
 void Cell::computeIntegration(double &integration)
 {
   if (!m_split) {
@@ -1591,27 +1627,19 @@ void Cell::computeMass(double &mass, double &alphaRef)
 
 //***********************************************************************
 
-void Cell::lookForPmax(double *pMax, double*pMaxWall)
+void Cell::computeMemory(std::vector<double> &octets) const
 {
-  if (!m_split) {
-    if (m_mixture->getPressure() > pMax[0]) {
-      pMax[0] = m_mixture->getPressure();
-      pMax[1] = m_element->getPosition().getX();
-      pMax[2] = m_element->getPosition().getY();
-      pMax[3] = m_element->getPosition().getZ();
-    }
-    if (m_mixture->getPressure() > pMaxWall[0] && m_element->getPosition().getX() < 0.005) {
-      pMaxWall[0] = m_mixture->getPressure();
-      pMaxWall[1] = m_element->getPosition().getX();
-      pMaxWall[2] = m_element->getPosition().getY();
-      pMaxWall[3] = m_element->getPosition().getZ();
-    }
-  }
-  else {
-    for (unsigned int i = 0; i < m_childrenCells.size(); i++) {
-      m_childrenCells[i]->lookForPmax(pMax, pMaxWall);
-    }
+  octets[memCells] += sizeof(*this) + (m_cellInterfaces.capacity() + m_childrenInternalCellInterfaces.capacity()) * sizeof(CellInterface*)
+    + m_childrenCells.capacity() * sizeof(Cell*) + m_vecQuantitiesAddPhys.capacity() * sizeof(QuantitiesAddPhys*);
+  if (m_vecPhases) {
+    octets[memPhases] += m_numberPhases * sizeof(Phase*);
+    for (int k = 0; k < m_numberPhases; k++) { octets[memPhases] += m_vecPhases[k]->getMemoryUsage(); }
   }
+  if (m_mixture) { octets[memMixtures] += m_mixture->getMemoryUsage(); }
+  if (m_cons) { octets[memFluxes] += m_cons->getMemoryUsage(m_numberPhases); }
+  if (m_vecTransports) { octets[memTransports] += 2 * m_numberTransports * sizeof(Transport); }
+  for (unsigned int qpa = 0; qpa < m_vecQuantitiesAddPhys.size(); qpa++) { octets[memAddPhys] += m_vecQuantitiesAddPhys[qpa]->getMemoryUsage(); }
+  if (m_element) { octets[memElements] += m_element->getMemoryUsage(); }
 }
 
 //***********************************************************************
@@ -2209,16 +2237,7 @@ void Cell::getDataToReceiveAndRefine(std::vector<double> &dataToReceive, std::ve
   const int &nbCellsY, const int &nbCellsZ, const std::vector<AddPhys*> &addPhys, Model *model)
 {
   if (m_lvl == lvl) {
-    for (int k = 0; k < m_numberPhases; k++) {
-      m_vecPhases[k]->getBuffer(dataToReceive, counter, eos);
-      this->getPhase(k, vecPhasesO2)->setEos(m_vecPhases[k]->getEos());
-    }
-    m_mixture->getBuffer(dataToReceive, counter);
-    for (int k = 0; k < m_numberTransports; k++) {
-      m_vecTransports[k].setValue(dataToReceive[counter++]);
-    }
-    this->fulfillState();
-    m_xi = dataToReceive[counter++];
+    this->getDataToReceive(dataToReceive, counter, eos);
 
     //Refine cell and internal cell interfaces
     m_split = dataSplitToReceive[counterSplit++];
@@ -2234,6 +2253,22 @@ void Cell::getDataToReceiveAndRefine(std::vector<double> &dataToReceive, std::ve
   }
 }
 
+//***********************************************************************
+
+void Cell::getDataToReceive(std::vector<double> &dataToReceive, int &counter, Eos **eos)
+{
+  for (int k = 0; k < m_numberPhases; k++) {
+    m_vecPhases[k]->getBuffer(dataToReceive, counter, eos);
+    this->getPhase(k, vecPhasesO2)->setEos(m_vecPhases[k]->getEos());
+  }
+  m_mixture->getBuffer(dataToReceive, counter);
+  for (int k = 0; k < m_numberTransports; k++) {
+    m_vecTransports[k].setValue(dataToReceive[counter++]);
+  }
+  this->fulfillState();
+  m_xi = dataToReceive[counter++];
+}
+
 //***************************************************************************
 
 void Cell::computeLoad(double &load, int lvl) const
@@ -95,7 +95,7 @@ class Cell
         void buildCons(const int &numberPhases);
         void correctionEnergy(const int &numberPhases);
         void sourceTermIntegration(const double &dt, const int &numberPhases) {};
-        void printPhasesMixture(const int &numberPhases, const int &numberTransports, std::ofstream &fileStream) const;
+        void printPhasesMixture(const int &numberPhases, const int &numberTransports, std::ostream &fileStream) const;
         virtual void completeFulfillState(Prim type = vecPhases);
         virtual void fulfillState(Prim type = vecPhases);
         virtual void localProjection(const Coord &normal, const Coord &tangent, const Coord &binormal, const int &numberPhases, Prim type = vecPhases);
@@ -186,10 +186,15 @@ class Cell
 
         //Printing
         //--------
-        bool printGnuplotAMR(std::ofstream &fileStream, const int &dim, GeometricObject *objet = 0);
+        bool printGnuplotAMR(std::ostream &fileStream, const int &dim, GeometricObject *objet = 0);
+        //! \brief     Extract the rows printed by printGnuplotAMR for several cuts in a single traversal of the cell tree
+        //! \param     objets           cut objects (lines or planes)
+        //! \param     coupes           indexes of the cuts crossed by the parent cell
+        //! \param     valeurs          for each cut, rows (projected coordinates then printed values) appended for the crossed leaf cells
+        void recupereCoupes(const std::vector<GeometricObject *> &objets, const std::vector<int> &coupes, std::vector< std::vector<double> > &valeurs) const;
         void computeIntegration(double &integration);
         void computeMass(double &mass, double &alphaRef);
-        void lookForPmax(double *pMax, double *pMaxWall);
+        virtual void computeMemory(std::vector<double> &octets) const; /*!< Add the bytes used by the cell and its variables to the categories of the memory accounting (TypeMemory) */
 
         //Specific for AMR method
         //-----------------------
@@ -246,6 +251,7 @@ class Cell
         void fillDataToSend(std::vector<double> &dataToSend, std::vector<int> &dataSplitToSend, const int &lvl) const;
         void getDataToReceiveAndRefine(std::vector<double> &dataToReceive, std::vector<int> &dataSplitToReceive, const int &lvl, Eos **eos, int &counter, int &counterSplit,
             const int &nbCellsY, const int &nbCellsZ, const std::vector<AddPhys*> &addPhys, Model *model);
+        void getDataToReceive(std::vector<double> &dataToReceive, int &counter, Eos **eos);                                          /*!< Read the cell state written by fillDataToSend (without the split flag) */
         void computeLoad(double &load, int lvl) const;
         void computeLvlMax(int &lvlMax) const;
         void clearExternalCellInterfaces(const int &nbCellsY, const int &nbCellsZ);
@@ -33,6 +33,7 @@
 //! \date      June 5 2019
 
 #include "CellInterface.h"
+#include "../Meshes/CriteriaAMR/CriterionAMR.h"
 #include <iostream>
 
 //Utile pour la resolution des problemes de Riemann
@@ -201,6 +202,14 @@ Face *CellInterface::getFace()
 
 //***********************************************************************
 
+void CellInterface::computeMemory(std::vector<double> &octets) const
+{
+  octets[memCellInterfaces] += sizeof(*this) + m_cellInterfacesChildren.capacity() * sizeof(CellInterface*);
+  if (m_face) { octets[memFaces] += m_face->getMemoryUsage(); }
+}
+
+//***********************************************************************
+
 Model *CellInterface::getMod() const
 {
   return m_mod;
@@ -224,42 +233,46 @@ Cell *CellInterface::getCellDroite() const
 //******************************Methode AMR***********************************
 //****************************************************************************
 
-void CellInterface::computeXi(const double &criteriaVar, const bool &varRho, const bool &varP, const bool &varU, const bool &varAlpha)
+void CellInterface::computeXi(const double &criteriaVar, const bool &varRho, const bool &varP, const bool &varU, const bool &varAlpha, const std::vector<CriterionAMR*> &criteria)
 {
-  if (varRho) { this->computeCritereAMR(criteriaVar, density); }
-  if (varP) {
-    if (m_cellLeft->getXi() < 0.99 || m_cellRight->getXi() < 0.99) { this->computeCritereAMR(criteriaVar, pressure); }
+  //Both cells already tagged by another cell interface
+  if (m_cellLeft->getXi() > 0.99 && m_cellRight->getXi() > 0.99) { return; }
+
+  //Fused evaluation: the states of both cells are read once for all the selected variables, the evaluation stops at the first variation above the criteria
+  bool split(false);
+  if (m_cellLeft->getNumberPhases() > 1) {
+    const Mixture *mixtureL(m_cellLeft->getMixture()), *mixtureR(m_cellRight->getMixture());
+    if (varRho) { split = this->variationAboveCritere(criteriaVar, mixtureL->getDensity(), mixtureR->getDensity(), 1.e-2); }
+    if (!split && varP) { split = this->variationAboveCritere(criteriaVar, mixtureL->getPressure(), mixtureR->getPressure(), 1.e-2); }
+    if (!split && varU) { split = this->variationAboveCritere(criteriaVar, mixtureL->getVelocity().norm(), mixtureR->getVelocity().norm(), 0.1); }
   }
-  if (varU) {
-    if (m_cellLeft->getXi() < 0.99 || m_cellRight->getXi() < 0.99) { this->computeCritereAMR(criteriaVar, velocityMag); }
+  else {
+    const Phase *phaseL(m_cellLeft->getPhase(0)), *phaseR(m_cellRight->getPhase(0));
+    if (varRho) { split = this->variationAboveCritere(criteriaVar, phaseL->getDensity(), phaseR->getDensity(), 1.e-2); }
+    if (!split && varP) { split = this->variationAboveCritere(criteriaVar, phaseL->getPressure(), phaseR->getPressure(), 1.e-2); }
+    if (!split && varU) { split = this->variationAboveCritere(criteriaVar, phaseL->getVelocity().norm(), phaseR->getVelocity().norm(), 0.1); }
+  }
+  if (!split && varAlpha && m_cellLeft->getNumberPhases() > 1) {
+    split = this->variationAboveCritere(criteriaVar, m_cellLeft->getPhase(1)->getAlpha(), m_cellRight->getPhase(1)->getAlpha(), 1.e-2);
   }
-  if (varAlpha) {
-    if (m_cellLeft->getXi() < 0.99 || m_cellRight->getXi() < 0.99) { this->computeCritereAMR(criteriaVar, alpha, 1); }
+  //User-defined criteria
+  for (unsigned int c = 0; c < criteria.size() && !split; c++) { split = criteria[c]->split(m_cellLeft, m_cellRight); }
+
+  //Mise a jour de xi si la variation est superieure au criteria
+  if (split) {
+    m_cellLeft->setXi(1.);
+    m_cellRight->setXi(1.);
   }
 }
 
 //***********************************************************************
 
-void CellInterface::computeCritereAMR(const double &criteriaVar, Variable nameVariable, int num)
+bool CellInterface::variationAboveCritere(const double &criteriaVar, const double &cg, const double &cd, const double &valueMinLimit) const
 {
-  double valueMin, variation, cd, cg;
-  // Recuperation des values de la variable en question a gauche et a droite
-  cg = m_cellLeft->selectScalar(nameVariable, num);
-  cd = m_cellRight->selectScalar(nameVariable, num);
-
   // Valeur de la variation
-  valueMin = std::min(std::fabs(cd), std::fabs(cg));
-  if (valueMin < 1.e-2) { //Utile pour alpha (quasi-seulement) ou velocity
-    if (nameVariable == velocityMag) { valueMin = 0.1; }
-    else {                             valueMin = 1.e-2; }
-  }
-  variation = std::fabs(cd - cg) / valueMin;
-
-  //Mise a jour de xi si la variation est superieure au criteria
-  if (variation >= criteriaVar) {
-    m_cellLeft->setXi(1.);
-    m_cellRight->setXi(1.);
-  }
+  double valueMin(std::min(std::fabs(cd), std::fabs(cg)));
+  if (valueMin < 1.e-2) { valueMin = valueMinLimit; } //Utile pour alpha (quasi-seulement) ou velocity
+  return (std::fabs(cd - cg) / valueMin >= criteriaVar);
 }
 
 //***********************************************************************
@@ -36,6 +36,7 @@
 //! \date      June 5 2019
 
 class CellInterface; //Predeclaration de la classe CellInterface pour pouvoir inclure Cell.h
+class CriterionAMR;
 
 #include "Cell.h"
 #include "../Models/Model.h"
@@ -75,6 +76,7 @@ class CellInterface
     void associeModel(Model *mod);
 
     virtual int whoAmI() const { return 0; };
+    virtual bool isWall() const { return false; };  //!< Vrai seulement pour une paroi (les symetries ordre 1, aussi de type 2, sont exclues)
 
     //Inutilise pour cell interfaces ordre 1
     virtual void allocateSlopes(const int &numberPhases, const int &numberTransports, int &allocateSlopeLocal) {};   /*!< Ne fait rien pour des cell interfaces ordre 1 */
@@ -92,6 +94,7 @@ class CellInterface
 
     //Accesseurs
     Face *getFace();                                            /*!< Attention, getFace() non const */
+    virtual void computeMemory(std::vector<double> &octets) const;  /*!< Add the bytes used by the cell interface, its face and its slopes to the categories of the memory accounting (TypeMemory) */
     Model *getMod() const;
     Cell *getCellGauche() const;
     Cell *getCellDroite() const;
@@ -99,8 +102,9 @@ class CellInterface
     //virtual double getDebit(int numPhase) const { Errors::errorMessage("getDebits non prevu pour CellInterface"); return 0.; }
 
     //Pour methode AMR
-    virtual void computeXi(const double &criteriaVar, const bool &varRho, const bool &varP, const bool &varU, const bool &varAlpha);  /*!< Calcul de la variable Xi pour criteria de (de)raffinement a priori */
-    void computeCritereAMR(const double &criteriaVar, Variable nameVariable, int num = 0);                                          /*!< Calcul de xi via le criteria de variation */
+    virtual void computeXi(const double &criteriaVar, const bool &varRho, const bool &varP, const bool &varU, const bool &varAlpha,
+      const std::vector<CriterionAMR*> &criteria);                     /*!< Calcul de la variable Xi pour criteria de (de)raffinement a priori (variables choisies et criteria utilisateur) */
+    bool variationAboveCritere(const double &criteriaVar, const double &cg, const double &cd, const double &valueMinLimit) const; /*!< Variation relative d une variable superieure au criteria */
     virtual void computeFluxXi();                                      /*!< Calcul des flux de Xi (diffusion) pour smoothing */
     virtual void creerCellInterfaceChild();                                                                        /*!< Creer un child cell interface (non initialize) */
     virtual void creerCellInterfaceChildInterne(const int &lvl, std::vector<CellInterface*> *childrenInternalCellInterfaces); /*!< Creer un intern child cell interface (non initialize) */
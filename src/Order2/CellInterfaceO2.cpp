@@ -315,6 +315,20 @@ Transport* CellInterfaceO2::getSlopesTransport(const int &numberTransport) const
 
 //***********************************************************************
 
+void CellInterfaceO2::computeMemory(std::vector<double> &octets) const
+{
+  CellInterface::computeMemory(octets);
+  octets[memCellInterfaces] += sizeof(*this) - sizeof(CellInterface);
+  if (m_vecPhasesSlopes) {
+    octets[memSlopes] += m_numberPhases * sizeof(Phase*);
+    for (int k = 0; k < m_numberPhases; k++) { octets[memSlopes] += m_vecPhasesSlopes[k]->getMemoryUsage(); }
+  }
+  if (m_mixtureSlopes) { octets[memSlopes] += m_mixtureSlopes->getMemoryUsage(); }
+  if (m_vecTransportsSlopes) { octets[memSlopes] += m_cellLeft->getNumberTransports() * sizeof(Transport); }
+}
+
+//***********************************************************************
+
 //Cell * CellInterfaceO2::getB(BO2 B) const 
 //{
 //  switch (B){
@@ -59,6 +59,7 @@ class CellInterfaceO2 : public CellInterface
     virtual Phase* getSlopesPhase(const int &phaseNumber) const;
     virtual Mixture* getSlopesMixture() const;
     virtual Transport* getSlopesTransport(const int &numberTransport) const;
+    virtual void computeMemory(std::vector<double> &octets) const;
     //virtual Cell *getB(BO2 B) const;
     //virtual double getBeta(betaO2 beta) const;
     //virtual double getDistanceH(distanceHO2 dist) const;
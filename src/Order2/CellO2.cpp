@@ -478,6 +478,22 @@ void CellO2::copyInCell(Cell &cellSource, Prim type) const
 
 //***********************************************************************
 
+void CellO2::computeMemory(std::vector<double> &octets) const
+{
+  Cell::computeMemory(octets);
+  octets[memCells] += sizeof(*this) - sizeof(Cell);
+  //Second order predicted states and saved conservative variables
+  if (m_vecPhasesO2) {
+    octets[memPhases] += m_numberPhases * sizeof(Phase*);
+    for (int k = 0; k < m_numberPhases; k++) { octets[memPhases] += m_vecPhasesO2[k]->getMemoryUsage(); }
+  }
+  if (m_mixtureO2) { octets[memMixtures] += m_mixtureO2->getMemoryUsage(); }
+  if (m_consSauvegarde) { octets[memFluxes] += m_consSauvegarde->getMemoryUsage(m_numberPhases); }
+  if (m_vecTransportsO2) { octets[memTransports] += 2 * m_numberTransports * sizeof(Transport); }
+}
+
+//***********************************************************************
+
 Phase* CellO2::getPhase(const int &phaseNumber, Prim type) const
 {
   switch (type){
@@ -60,6 +60,7 @@ class CellO2 : public Cell
         virtual void fulfillState(Prim type = vecPhases);
         virtual void localProjection(const Coord &normal, const Coord &tangent, const Coord &binormal, const int &numberPhases, Prim type = vecPhases);
         virtual void copyInCell(Cell &cellSource, Prim type=vecPhases) const;
+        virtual void computeMemory(std::vector<double> &octets) const;
 
         //Accesseurs
         virtual Phase* getPhase(const int &phaseNumber, Prim type = vecPhases) const;
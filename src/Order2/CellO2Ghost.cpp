@@ -122,6 +122,25 @@ void CellO2Ghost::setRankOfNeighborCPU(int rank)
 
 //***********************************************************************
 
+void CellO2Ghost::computeMemory(std::vector<double> &octets) const
+{
+  CellO2::computeMemory(octets);
+  octets[memCells] += sizeof(*this) - sizeof(CellO2);
+  //Slopes received from the neighbour CPU
+  octets[memSlopes] += m_indexCellInterface.capacity() * sizeof(int) + m_vecPhasesSlopesGhost.capacity() * sizeof(Phase**)
+    + m_mixtureSlopesGhost.capacity() * sizeof(Mixture*) + m_vecTransportsSlopesGhost.capacity() * sizeof(double*) + m_alphaCellAfterOppositeSide.capacity() * sizeof(double);
+  for (unsigned int s = 0; s < m_vecPhasesSlopesGhost.size(); s++) {
+    if (m_vecPhasesSlopesGhost[s]) {
+      octets[memSlopes] += m_numberPhases * sizeof(Phase*);
+      for (int k = 0; k < m_numberPhases; k++) { octets[memSlopes] += m_vecPhasesSlopesGhost[s][k]->getMemoryUsage(); }
+    }
+    if (m_mixtureSlopesGhost[s]) { octets[memSlopes] += m_mixtureSlopesGhost[s]->getMemoryUsage(); }
+    if (m_vecTransportsSlopesGhost[s]) { octets[memSlopes] += m_numberTransports * sizeof(double); }
+  }
+}
+
+//***********************************************************************
+
 void CellO2Ghost::computeLocalSlopes(const int &numberPhases, const int &numberTransports, CellInterface &cellInterfaceRef, Limiter &globalLimiter, Limiter &interfaceLimiter, Limiter &globalVolumeFractionLimiter, Limiter &interfaceVolumeFractionLimiter, double &alphaCellAfterOppositeSide, double &alphaCell, double &alphaCellOtherInterfaceSide, double &epsInterface)
 {
 	//Find the corresponding slopes store inside this ghost cell
@@ -52,6 +52,7 @@ public:
 	virtual void createChildCell(const int &lvl);
 	virtual void getBufferSlopes(double *buffer, int &counter, const int &lvl);
 	virtual bool isCellGhost() const { return true; };
+	virtual void computeMemory(std::vector<double> &octets) const;
 
 protected:
 	int m_rankOfNeighborCPU;                            /*!< Rank of the neighbor CPU corresponding to this ghost cell */
@@ -34,14 +34,46 @@
 
 #include "Parallel.h"
 #include "../Eos/Eos.h"
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
 
 //Variables linked to parallel computation
 Parallel parallel;
 int rankCpu, Ncpu;
 
+//! \brief     MPI reduction operator of the diagnostics monitors: sums then maxima carrying their location
+//! \details   Each element is a contiguous block of doubles: the number of sums, the sums, then the maxima stored as (value, x, y, z)
+static void reductionMonitors(void *in, void *inout, int *len, MPI_Datatype *datatype)
+{
+  int size;
+  MPI_Type_size(*datatype, &size);
+  int numberValues(size / static_cast<int>(sizeof(double)));
+  for (int e = 0; e < *len; e++) {
+    double *a(static_cast<double *>(in) + e*numberValues), *b(static_cast<double *>(inout) + e*numberValues);
+    int numberSums(static_cast<int>(a[0]));
+    for (int i = 1; i <= numberSums; i++) { b[i] += a[i]; }
+    for (int i = numberSums + 1; i + 3 < numberValues; i += 4) {
+      if (a[i] > b[i]) { for (int j = 0; j < 4; j++) b[i + j] = a[i + j]; }
+    }
+  }
+}
+
+//! \brief     MPI reduction operator of the time step with the telemetry counters: minimum, maximum, then sums
+//! \details   Each element is a contiguous block of 4 doubles (see Parallel::computeDtTelemetry)
+static void reductionTelemetry(void *in, void *inout, int *len, MPI_Datatype *)
+{
+  for (int e = 0; e < *len; e++) {
+    double *a(static_cast<double *>(in) + 4*e), *b(static_cast<double *>(inout) + 4*e);
+    b[0] = std::min(a[0], b[0]);
+    b[1] = std::max(a[1], b[1]);
+    for (int i = 2; i < 4; i++) { b[i] += a[i]; }
+  }
+}
+
 //***********************************************************************
 
-Parallel::Parallel(): m_stateCPU(1) {}
+Parallel::Parallel(): m_stateCPU(1), m_octetsEnvoyes(0), m_iterationRapport(-1), m_opMonitors(MPI_OP_NULL), m_opTelemetry(MPI_OP_NULL), m_typeTelemetry(MPI_DATATYPE_NULL) {}
 
 //***********************************************************************
 
@@ -53,6 +85,15 @@ void Parallel::initialization(int &argc, char* argv[])
 {
   if (Ncpu == 1) return; //The following is not necessary in the case of monoCPU
 
+  //Lists and counters possibly left by a previous test case run in the same execution
+  m_elementsToSend.clear();
+  m_elementsToReceive.clear();
+  m_octetsEnvoyes = 0;
+  m_octetsCom.clear(); m_messagesCom.clear();
+  m_octetsRapport.clear(); m_messagesRapport.clear();
+  m_iterationRapport = -1;
+  m_octetsBuffers.clear();
+
   m_isNeighbour = new bool[Ncpu];
   m_elementsToSend.resize(Ncpu);
   m_elementsToReceive.resize(Ncpu);
@@ -241,15 +282,23 @@ void Parallel::computeDt(double &dt)
 {
   double dt_temp = dt;
   MPI_Allreduce(&dt_temp, &dt, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  this->compteCommunication(comReduction, 0, rankCpu, sizeof(double));
 }
 
 //***********************************************************************
 
-void Parallel::computePMax(double &pMax, double &pMaxWall)
+void Parallel::computeDtTelemetry(double &dt, double *counters)
 {
-  double pMax_temp(pMax), pMaxWall_temp(pMaxWall);
-  MPI_Allreduce(&pMax_temp, &pMax, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  MPI_Allreduce(&pMaxWall_temp, &pMaxWall, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  if (m_opTelemetry == MPI_OP_NULL) {
+    MPI_Op_create(&reductionTelemetry, 1, &m_opTelemetry);
+    MPI_Type_contiguous(4, MPI_DOUBLE, &m_typeTelemetry);
+    MPI_Type_commit(&m_typeTelemetry);
+  }
+  double valuesCpu[4] = { dt, counters[0], counters[1], counters[2] }, values[4];
+  MPI_Allreduce(valuesCpu, values, 1, m_typeTelemetry, m_opTelemetry, MPI_COMM_WORLD);
+  dt = values[0];
+  for (int i = 0; i < 3; i++) { counters[i] = values[i + 1]; }
+  this->compteCommunication(comReduction, 0, rankCpu, 4*sizeof(double));
 }
 
 //***********************************************************************
@@ -258,6 +307,33 @@ void Parallel::computeMassTotal(double &mass)
 {
   double mass_temp(mass);
   MPI_Allreduce(&mass_temp, &mass, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  this->compteCommunication(comReduction, 0, rankCpu, sizeof(double));
+}
+
+//***********************************************************************
+
+void Parallel::computeNbCellsTotalAMR(int &nbCellsTotalAMR)
+{
+  int nbCellsTotalAMR_temp(nbCellsTotalAMR);
+  MPI_Allreduce(&nbCellsTotalAMR_temp, &nbCellsTotalAMR, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  this->compteCommunication(comReduction, 0, rankCpu, sizeof(int));
+}
+
+//***********************************************************************
+
+void Parallel::reduceMonitors(std::vector<double> &values, const int &numberSums)
+{
+  if (m_opMonitors == MPI_OP_NULL) MPI_Op_create(&reductionMonitors, 1, &m_opMonitors);
+  //The monitors are reduced as one element carrying its number of sums in front of the values
+  std::vector<double> valuesCpu(1, static_cast<double>(numberSums)), valuesReduced(values.size() + 1);
+  valuesCpu.insert(valuesCpu.end(), values.begin(), values.end());
+  MPI_Datatype typeMonitors;
+  MPI_Type_contiguous(static_cast<int>(valuesCpu.size()), MPI_DOUBLE, &typeMonitors);
+  MPI_Type_commit(&typeMonitors);
+  MPI_Reduce(valuesCpu.data(), valuesReduced.data(), 1, typeMonitors, m_opMonitors, 0, MPI_COMM_WORLD);
+  MPI_Type_free(&typeMonitors);
+  if (rankCpu == 0) { std::copy(valuesReduced.begin() + 1, valuesReduced.end(), values.begin()); }
+  this->compteCommunication(comReduction, 0, rankCpu, valuesCpu.size()*sizeof(double));
 }
 
 //***********************************************************************
@@ -265,11 +341,15 @@ void Parallel::computeMassTotal(double &mass)
 void Parallel::finalize(const int &lvlMax)
 {
   if (Ncpu > 1) {
+    m_octetsBuffers.clear();
     this->finalizePersistentCommunicationsPrimitives(lvlMax);
     this->finalizePersistentCommunicationsSlopes(lvlMax);
     this->finalizePersistentCommunicationsVector(lvlMax);
     this->finalizePersistentCommunicationsTransports(lvlMax);
   }
+  if (m_opMonitors != MPI_OP_NULL) { MPI_Op_free(&m_opMonitors); }
+  if (m_opTelemetry != MPI_OP_NULL) { MPI_Op_free(&m_opTelemetry); }
+  if (m_typeTelemetry != MPI_DATATYPE_NULL) { MPI_Type_free(&m_typeTelemetry); }
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
@@ -290,6 +370,7 @@ void Parallel::verifyStateCPUs()
   int nbErr_temp(0);
   int nbErr(errors.size());
   MPI_Allreduce(&nbErr, &nbErr_temp, 1, MPI_INTEGER, MPI_SUM, MPI_COMM_WORLD);
+  this->compteCommunication(comReduction, 0, rankCpu, sizeof(int));
   //Stop if error on one CPU
   if (nbErr_temp) {
     Errors::arretCodeApresError(errors);
@@ -317,6 +398,7 @@ void Parallel::initializePersistentCommunicationsPrimitives()
       m_reqReceive[0][neighbour] = new MPI_Request;
       m_bufferReceive[0][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceive[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceive[0][neighbour]);
+      this->compteBuffers(0, (numberSend + numberReceive) * sizeof(double));
     }
   }
 }
@@ -361,6 +443,7 @@ void Parallel::communicationsPrimitives(Eos **eos, int lvl, Prim type)
       for (int i = 0; i < m_numberElementsToSendToNeighbour[neighbour]; i++) {
         m_elementsToSend[neighbour][i]->fillBufferPrimitives(m_bufferSend[lvl][neighbour], count, lvl, neighbour, type);
       }
+      this->compteCommunication(comPrimitives, lvl, neighbour, (count + 1) * sizeof(double));
 
       //Sending request
       MPI_Start(m_reqSend[lvl][neighbour]);
@@ -404,6 +487,7 @@ void Parallel::initializePersistentCommunicationsSlopes()
       m_reqReceiveSlopes[0][neighbour] = new MPI_Request;
       m_bufferReceiveSlopes[0][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveSlopes[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSlopes[0][neighbour]);
+      this->compteBuffers(0, (numberSend + numberReceive) * sizeof(double));
     }
   }
 }
@@ -448,6 +532,7 @@ void Parallel::communicationsSlopes(int lvl)
       for (int i = 0; i < m_numberElementsToSendToNeighbour[neighbour]; i++) {
         m_elementsToSend[neighbour][i]->fillBufferSlopes(m_bufferSendSlopes[lvl][neighbour], count, lvl, neighbour);
       }
+      this->compteCommunication(comSlopes, lvl, neighbour, (count + 1) * sizeof(double));
 
       //Sending request
       MPI_Start(m_reqSendSlopes[lvl][neighbour]);
@@ -494,6 +579,7 @@ void Parallel::initializePersistentCommunicationsScalar()
       m_reqReceiveScalar[0][neighbour] = new MPI_Request;
       m_bufferReceiveScalar[0][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveScalar[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveScalar[0][neighbour]);
+      this->compteBuffers(0, (numberSend + numberReceive) * sizeof(double));
     }
   }
 }
@@ -545,6 +631,7 @@ void Parallel::initializePersistentCommunicationsVector(const int &dim)
       m_reqReceiveVector[0][neighbour] = new MPI_Request;
       m_bufferReceiveVector[0][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveVector[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveVector[0][neighbour]);
+      this->compteBuffers(0, (numberSend + numberReceive) * sizeof(double));
     }
   }
 }
@@ -590,6 +677,7 @@ void Parallel::communicationsVector(Variable nameVector, const int &dim, int lvl
         //Automatic filing of m_bufferSendVector function of gradient coordinates
         m_elementsToSend[neighbour][i]->fillBufferVector(m_bufferSendVector[lvl][neighbour], count, lvl, neighbour, dim, nameVector, num, index);
       }
+      this->compteCommunication(comVector, lvl, neighbour, (count + 1) * sizeof(double));
 
       //Sending request
       MPI_Start(m_reqSendVector[lvl][neighbour]);
@@ -633,6 +721,7 @@ void Parallel::initializePersistentCommunicationsTransports()
       m_reqReceiveTransports[0][neighbour] = new MPI_Request;
       m_bufferReceiveTransports[0][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveTransports[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveTransports[0][neighbour]);
+      this->compteBuffers(0, (numberSend + numberReceive) * sizeof(double));
     }
   }
 }
@@ -678,6 +767,7 @@ void Parallel::communicationsTransports(int lvl)
       for (int i = 0; i < m_numberElementsToSendToNeighbour[neighbour]; i++) {
         m_elementsToSend[neighbour][i]->fillBufferTransports(m_bufferSendTransports[lvl][neighbour], count, lvl, neighbour);
       }
+      this->compteCommunication(comTransports, lvl, neighbour, (count + 1) * sizeof(double));
 
       //Sending request
       MPI_Start(m_reqSendTransports[lvl][neighbour]);
@@ -877,6 +967,7 @@ void Parallel::initializePersistentCommunicationsLvlAMR(const int &lvlMax)
 
 void Parallel::clearRequestsAndBuffers(int lvl)
 {
+  if (lvl < static_cast<int>(m_octetsBuffers.size())) m_octetsBuffers[lvl] = 0;
   for (int neighbour = 0; neighbour < Ncpu; neighbour++) {
     if (m_reqSend[lvl][neighbour] != NULL) {
       MPI_Request_free(m_reqSend[lvl][neighbour]);
@@ -994,6 +1085,7 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int &dim)
       m_reqReceive[lvl][neighbour] = new MPI_Request;
       m_bufferReceive[lvl][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceive[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceive[lvl][neighbour]);
+      this->compteBuffers(lvl, (numberSend + numberReceive) * sizeof(double));
 
       //Slope variables
       //---------------
@@ -1009,6 +1101,7 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int &dim)
       m_reqReceiveSlopes[lvl][neighbour] = new MPI_Request;
       m_bufferReceiveSlopes[lvl][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveSlopes[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSlopes[lvl][neighbour]);
+      this->compteBuffers(lvl, (numberSend + numberReceive) * sizeof(double));
 
       //Vector variables
       //----------------
@@ -1023,6 +1116,7 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int &dim)
       m_reqReceiveVector[lvl][neighbour] = new MPI_Request;
       m_bufferReceiveVector[lvl][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveVector[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveVector[lvl][neighbour]);
+      this->compteBuffers(lvl, (numberSend + numberReceive) * sizeof(double));
 
       //Transported variables
       //---------------------
@@ -1037,6 +1131,7 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int &dim)
       m_reqReceiveTransports[lvl][neighbour] = new MPI_Request;
       m_bufferReceiveTransports[lvl][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveTransports[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveTransports[lvl][neighbour]);
+      this->compteBuffers(lvl, (numberSend + numberReceive) * sizeof(double));
 
       //Xi variable
       //-----------
@@ -1051,6 +1146,7 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int &dim)
       m_reqReceiveXi[lvl][neighbour] = new MPI_Request;
       m_bufferReceiveXi[lvl][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveXi[lvl][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveXi[lvl][neighbour]);
+      this->compteBuffers(lvl, (numberSend + numberReceive) * sizeof(double));
 
       //Split variable
       //--------------
@@ -1063,6 +1159,7 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int &dim)
       m_reqReceiveSplit[lvl][neighbour] = new MPI_Request;
       m_bufferReceiveSplit[lvl][neighbour] = new bool[numberReceive];
       MPI_Recv_init(m_bufferReceiveSplit[lvl][neighbour], numberReceive, MPI_C_BOOL, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSplit[lvl][neighbour]);
+      this->compteBuffers(lvl, (numberSend + numberReceive) * sizeof(bool));
     }
   }
 }
@@ -1072,6 +1169,7 @@ void Parallel::updatePersistentCommunicationsLvlAMR(int lvl, const int &dim)
 void Parallel::finalizeAMR(const int &lvlMax)
 {
   if (Ncpu > 1) {
+    m_octetsBuffers.clear();
     this->finalizePersistentCommunicationsPrimitives(lvlMax);
     this->finalizePersistentCommunicationsSlopes(lvlMax);
     this->finalizePersistentCommunicationsVector(lvlMax);
@@ -1104,6 +1202,7 @@ void Parallel::initializePersistentCommunicationsXi()
       m_reqReceiveXi[0][neighbour] = new MPI_Request;
       m_bufferReceiveXi[0][neighbour] = new double[numberReceive];
       MPI_Recv_init(m_bufferReceiveXi[0][neighbour], numberReceive, MPI_DOUBLE, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveXi[0][neighbour]);
+      this->compteBuffers(0, (numberSend + numberReceive) * sizeof(double));
     }
   }
 }
@@ -1149,6 +1248,7 @@ void Parallel::communicationsXi(int lvl)
         //Automatic filing of m_bufferSendXi
         m_elementsToSend[neighbour][i]->fillBufferXi(m_bufferSendXi[lvl][neighbour], count, lvl, neighbour);
       }
+      this->compteCommunication(comXi, lvl, neighbour, (count + 1) * sizeof(double));
 
       //Sending request
       MPI_Start(m_reqSendXi[lvl][neighbour]);
@@ -1193,6 +1293,7 @@ void Parallel::initializePersistentCommunicationsSplit()
       m_reqReceiveSplit[0][neighbour] = new MPI_Request;
       m_bufferReceiveSplit[0][neighbour] = new bool[numberReceive];
       MPI_Recv_init(m_bufferReceiveSplit[0][neighbour], numberReceive, MPI_C_BOOL, neighbour, rankCpu, MPI_COMM_WORLD, m_reqReceiveSplit[0][neighbour]);
+      this->compteBuffers(0, (numberSend + numberReceive) * sizeof(bool));
     }
   }
 }
@@ -1238,6 +1339,7 @@ void Parallel::communicationsSplit(int lvl)
         //Automatic filing of m_bufferSendSplit
         m_elementsToSend[neighbour][i]->fillBufferSplit(m_bufferSendSplit[lvl][neighbour], count, lvl, neighbour);
       }
+      this->compteCommunication(comSplit, lvl, neighbour, (count + 1) * sizeof(bool));
 
       //Sending request
       MPI_Start(m_reqSendSplit[lvl][neighbour]);
@@ -1371,3 +1473,148 @@ void Parallel::communicationsNumberGhostCells(int lvl)
 }
 
 //***********************************************************************
+
+//****************************************************************************
+//********************** Methods for communication counters ******************
+//****************************************************************************
+
+static const char* nameTypeCom[nbTypesCom] = { "primitives", "slopes", "transports", "vector", "xi", "split", "balancing", "reductions" };
+
+//***********************************************************************
+
+void Parallel::compteCommunication(const TypeCom &type, const int &lvl, const int &neighbour, const long long &octets, const int &messages)
+{
+  unsigned int index((lvl*nbTypesCom + type)*Ncpu + neighbour);
+  if (index >= m_octetsCom.size()) {
+    //New level: counters are appended
+    m_octetsCom.resize((lvl + 1)*nbTypesCom*Ncpu, 0);
+    m_messagesCom.resize((lvl + 1)*nbTypesCom*Ncpu, 0);
+  }
+  m_octetsCom[index] += octets;
+  m_messagesCom[index] += messages;
+  if (type != comReduction) m_octetsEnvoyes += octets;
+}
+
+//***********************************************************************
+
+void Parallel::compteBuffers(const int &lvl, const long long &octets)
+{
+  if (lvl >= static_cast<int>(m_octetsBuffers.size())) m_octetsBuffers.resize(lvl + 1, 0);
+  m_octetsBuffers[lvl] += octets;
+}
+
+//***********************************************************************
+
+void Parallel::computeMemory(std::vector<double> &octetsLvl) const
+{
+  int nbLvl(octetsLvl.size() / nbTypesMemory);
+  for (unsigned int lvl = 0; lvl < m_octetsBuffers.size() && static_cast<int>(lvl) < nbLvl; lvl++) {
+    octetsLvl[lvl*nbTypesMemory + memParallel] += m_octetsBuffers[lvl];
+  }
+  //Lists of cells to send and receive (level 0) and per-neighbour arrays
+  for (unsigned int neighbour = 0; neighbour < m_elementsToSend.size(); neighbour++) {
+    octetsLvl[memParallel] += (m_elementsToSend[neighbour].capacity() + m_elementsToReceive[neighbour].capacity()) * sizeof(Cell*);
+  }
+  octetsLvl[memParallel] += Ncpu * (sizeof(bool) + 8 * sizeof(int));
+}
+
+//***********************************************************************
+
+void Parallel::reportCommunications(const std::string &fileName, const int &iteration, const int &nbCellsInterior, const int &nbCellsHalo)
+{
+  //Local cumulative and per-step volumes of each type
+  std::vector<long long> octets(nbTypesCom, 0), messages(nbTypesCom, 0);
+  for (unsigned int i = 0; i < m_octetsCom.size(); i++) {
+    int type((i / Ncpu) % nbTypesCom);
+    octets[type] += m_octetsCom[i];
+    messages[type] += m_messagesCom[i];
+  }
+  if (m_octetsRapport.empty()) { m_octetsRapport.resize(nbTypesCom, 0); m_messagesRapport.resize(nbTypesCom, 0); }
+  int nbSteps(m_iterationRapport < 0 ? iteration : iteration - m_iterationRapport);
+  std::vector<double> local(4 * nbTypesCom), somme(4 * nbTypesCom), maximum(4 * nbTypesCom);
+  for (int t = 0; t < nbTypesCom; t++) {
+    local[t] = static_cast<double>(octets[t]);
+    local[nbTypesCom + t] = static_cast<double>(messages[t]);
+    local[2 * nbTypesCom + t] = (nbSteps > 0 ? static_cast<double>(octets[t] - m_octetsRapport[t]) / nbSteps : 0.);
+    local[3 * nbTypesCom + t] = (nbSteps > 0 ? static_cast<double>(messages[t] - m_messagesRapport[t]) / nbSteps : 0.);
+  }
+  MPI_Reduce(&local[0], &somme[0], 4 * nbTypesCom, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+  MPI_Reduce(&local[0], &maximum[0], 4 * nbTypesCom, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  int cells[2] = { nbCellsInterior, nbCellsHalo };
+  std::vector<int> cellsCpu(2 * Ncpu);
+  MPI_Gather(cells, 2, MPI_INT, &cellsCpu[0], 2, MPI_INT, 0, MPI_COMM_WORLD);
+  bool premierRapport(m_iterationRapport < 0);
+  m_octetsRapport = octets;
+  m_messagesRapport = messages;
+  m_iterationRapport = iteration;
+  if (rankCpu != 0) return;
+
+  std::ofstream fileStream(fileName.c_str(), premierRapport ? std::ios::out | std::ios::trunc : std::ios::app);
+  fileStream << "Iteration " << iteration << " (" << nbSteps << " steps since previous report)" << std::endl;
+  fileStream << std::left << std::setw(12) << "type" << std::right << std::setw(16) << "bytes" << std::setw(14) << "messages"
+    << std::setw(16) << "bytes/step" << std::setw(16) << "max CPU" << std::setw(14) << "msg/step" << std::setw(14) << "max CPU" << std::endl;
+  for (int t = 0; t < nbTypesCom; t++) {
+    fileStream << std::left << std::setw(12) << nameTypeCom[t] << std::right << std::fixed << std::setprecision(0)
+      << std::setw(16) << somme[t] << std::setw(14) << somme[nbTypesCom + t]
+      << std::setprecision(1) << std::setw(16) << somme[2 * nbTypesCom + t] << std::setw(16) << maximum[2 * nbTypesCom + t]
+      << std::setw(14) << somme[3 * nbTypesCom + t] << std::setw(14) << maximum[3 * nbTypesCom + t] << std::endl;
+  }
+  //Halo-to-interior leaf cells ratios
+  double ratioMin(1.e30), ratioMax(0.), ratioMoy(0.);
+  fileStream << "halo/interior cells:";
+  for (int p = 0; p < Ncpu; p++) {
+    double ratio(cellsCpu[2 * p] > 0 ? static_cast<double>(cellsCpu[2 * p + 1]) / cellsCpu[2 * p] : 0.);
+    ratioMin = std::min(ratioMin, ratio); ratioMax = std::max(ratioMax, ratio); ratioMoy += ratio / Ncpu;
+    fileStream << " CPU" << p << " " << cellsCpu[2 * p + 1] << "/" << cellsCpu[2 * p] << "=" << std::setprecision(4) << ratio;
+  }
+  fileStream << std::endl << "halo/interior ratio min/avg/max: " << ratioMin << " " << ratioMoy << " " << ratioMax << std::endl << std::endl;
+}
+
+//***********************************************************************
+
+void Parallel::printCommunicationsStats(const std::string &fileNameMatrix, const int &numTest) const
+{
+  //Number of levels known by every CPU
+  int nbLvlLocal(m_octetsCom.size() / (nbTypesCom*Ncpu)), nbLvl(0);
+  MPI_Allreduce(&nbLvlLocal, &nbLvl, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  if (nbLvl == 0) return;
+
+  //Cumulative volumes per level and type (summed over CPUs) and sent to each neighbour (all types)
+  std::vector<double> local(2 * nbLvl * nbTypesCom, 0.), somme(2 * nbLvl * nbTypesCom, 0.);
+  std::vector<double> ligne(Ncpu, 0.), matrice(rankCpu == 0 ? Ncpu * Ncpu : 1, 0.);
+  for (unsigned int i = 0; i < m_octetsCom.size(); i++) {
+    int lvlType(i / Ncpu), neighbour(i % Ncpu);
+    local[lvlType] += m_octetsCom[i];
+    local[nbLvl * nbTypesCom + lvlType] += m_messagesCom[i];
+    if (lvlType % nbTypesCom != comReduction) ligne[neighbour] += m_octetsCom[i];
+  }
+  MPI_Reduce(&local[0], &somme[0], 2 * nbLvl * nbTypesCom, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+  MPI_Gather(&ligne[0], Ncpu, MPI_DOUBLE, &matrice[0], Ncpu, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  if (rankCpu != 0) return;
+
+  std::ios::fmtflags drapeaux(std::cout.flags());
+  std::streamsize precision(std::cout.precision());
+  std::cout << "T" << numTest << " | -------------------------------------------" << std::endl;
+  std::cout << "T" << numTest << " | COMMUNICATION VOLUMES (SUM OVER CPUS)" << std::endl;
+  std::cout << "T" << numTest << " |     " << std::left << std::setw(14) << "Type" << std::right << std::setw(6) << "Level"
+    << std::setw(14) << "MB" << std::setw(14) << "Messages" << std::endl;
+  for (int lvl = 0; lvl < nbLvl; lvl++) {
+    for (int t = 0; t < nbTypesCom; t++) {
+      double octets(somme[lvl * nbTypesCom + t]), messages(somme[nbLvl * nbTypesCom + lvl * nbTypesCom + t]);
+      if (messages == 0.) continue;
+      std::cout << "T" << numTest << " |     " << std::left << std::setw(14) << nameTypeCom[t] << std::right << std::setw(6) << lvl
+        << std::fixed << std::setprecision(3) << std::setw(14) << octets / 1.e6 << std::setprecision(0) << std::setw(14) << messages << std::endl;
+    }
+  }
+  std::cout.flags(drapeaux);
+  std::cout.precision(precision);
+
+  //Matrix of the bytes sent from each CPU (line) to each CPU (column), halo exchanges and balancing
+  std::ofstream fileStream(fileNameMatrix.c_str(), std::ios::out | std::ios::trunc);
+  fileStream << "# Bytes sent from CPU (line) to CPU (column): halo exchanges and load balancing" << std::endl;
+  fileStream << std::fixed << std::setprecision(0);
+  for (int p = 0; p < Ncpu; p++) {
+    for (int q = 0; q < Ncpu; q++) { fileStream << (q > 0 ? " " : "") << matrice[p * Ncpu + q]; }
+    fileStream << std::endl;
+  }
+}
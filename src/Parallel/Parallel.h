@@ -40,6 +40,9 @@
 #include "../Models/Phase.h"
 #include "../Order1/Cell.h"
 
+//! \brief     Types of communication followed by the counters of Parallel
+enum TypeCom { comPrimitives, comSlopes, comTransports, comVector, comXi, comSplit, comBalancing, comReduction, nbTypesCom };
+
 class Parallel
 {
 public:
@@ -58,8 +61,16 @@ public:
   TypeMeshContainer<Cell*> &getElementsToReceive(int neighbour);
   void initializePersistentCommunications(const int &numberPrimitiveVariables, const int &numberSlopeVariables, const int &numberTransportVariables, const int &dim);
   void computeDt(double &dt);
-  void computePMax(double &pMax, double &pMaxWall);
+  //! \brief     Time step reduction carrying the telemetry counters of the CPUs in the same collective
+  //! \param     dt                time step of the CPU, minimum over the CPUs on return
+  //! \param     counters          load of the CPU twice then its number of AMR cells, on return: maximum load, total load and total number of AMR cells
+  void computeDtTelemetry(double &dt, double *counters);
   void computeMassTotal(double &mass);
+  void computeNbCellsTotalAMR(int &nbCellsTotalAMR);
+  //! \brief     Fused reduction on CPU 0 of the diagnostics monitors (one collective for all of them)
+  //! \param     values            numberSums sums then maxima stored as (value, x, y, z), reduced values on CPU 0
+  //! \param     numberSums        number of values reduced by a sum
+  void reduceMonitors(std::vector<double> &values, const int &numberSums);
   void finalize(const int &lvlMax);
   void stopRun();
   void verifyStateCPUs();
@@ -108,9 +119,37 @@ public:
   void finalizePersistentCommunicationsNumberGhostCells();
   void communicationsNumberGhostCells(int lvl);
 
+  //Communication counters
+  //! \brief     Count the bytes and messages sent to a neighbour (collectives are counted with the CPU itself as neighbour)
+  void compteCommunication(const TypeCom &type, const int &lvl, const int &neighbour, const long long &octets, const int &messages = 1);
+  //! \brief     Append the cumulative and per-step volumes of each type and the halo-to-interior ratios to a report file (collective)
+  //! \param     fileName          report file (written by CPU 0)
+  //! \param     iteration         current iteration (per-step volumes are averaged since the previous report)
+  //! \param     nbCellsInterior   number of computational leaf cells of the CPU
+  //! \param     nbCellsHalo       number of ghost leaf cells of the CPU
+  void reportCommunications(const std::string &fileName, const int &iteration, const int &nbCellsInterior, const int &nbCellsHalo);
+  //! \brief     Print the cumulative volumes per type and level and write the CPU-to-CPU volume matrix (collective)
+  void printCommunicationsStats(const std::string &fileNameMatrix, const int &numTest) const;
+  const long long &getOctetsEnvoyes() const { return m_octetsEnvoyes; };
+  //! \brief     Add the bytes of the persistent communication buffers of each level and of the lists of cells to exchange to the memory accounting
+  //! \param     octetsLvl         bytes per level and category (index lvl*nbTypesMemory + type), memParallel is incremented
+  void computeMemory(std::vector<double> &octetsLvl) const;
+
 private:
+  //! \brief     Count the bytes of persistent communication buffers allocated for a level (reset by clearRequestsAndBuffers)
+  void compteBuffers(const int &lvl, const long long &octets);
     
   int m_stateCPU;
+  long long m_octetsEnvoyes;               /*Cumulative number of bytes sent to neighbours (halo exchanges and load balancing)*/
+  std::vector<long long> m_octetsCom;      /*Cumulative bytes sent per level, type and neighbour (index (lvl*nbTypesCom + type)*Ncpu + neighbour)*/
+  std::vector<long long> m_messagesCom;    /*Cumulative messages sent, same layout*/
+  std::vector<long long> m_octetsRapport;  /*Bytes per type at the previous report*/
+  std::vector<long long> m_messagesRapport;/*Messages per type at the previous report*/
+  int m_iterationRapport;                  /*Iteration of the previous report (-1: no report yet)*/
+  std::vector<long long> m_octetsBuffers;  /*Bytes of the persistent communication buffers allocated per level*/
+  MPI_Op m_opMonitors;                     /*Reduction operator of the diagnostics monitors (created at the first reduction)*/
+  MPI_Op m_opTelemetry;                    /*Reduction operator of the time step with the telemetry counters (created at the first reduction)*/
+  MPI_Datatype m_typeTelemetry;            /*Contiguous block of the 4 doubles reduced by m_opTelemetry, sent as a single element*/
   bool *m_isNeighbour;
   std::vector<TypeMeshContainer<Cell*>> m_elementsToSend;
   std::vector<TypeMeshContainer<Cell*>> m_elementsToReceive;
@@ -33,13 +33,18 @@
 //! \date      June 5 2019
 
 #include "Run.h"
+#include "InputOutput/OutputCutGNU.h"
+#include "InputOutput/OutputProbeGNU.h"
+#include "InputOutput/OutputProbeArray.h"
+#include <iomanip>
 
 using namespace tinyxml2;
 
 //***********************************************************************
 
 Run::Run(std::string nameCasTest, const int &number) : m_numberTransports(0), m_restartSimulation(0), m_restartAMRsaveFreq(0),
-  m_dt(1.e-15), m_physicalTime(0.), m_iteration(0), m_simulationName(nameCasTest), m_numTest(number), m_MRF(-1)
+  m_dt(1.e-15), m_physicalTime(0.), m_iteration(0), m_simulationName(nameCasTest), m_numTest(number), m_MRF(-1),
+  m_nbRemaillages(0), m_cellUpdates(0), m_checkpointFreq(0), m_restartFromCheckpoint(false), m_diagnostics(0), m_telemetry(0), m_memoryReports(0), m_memoryAccounted(0.), m_memoryPerLeafCell(0.), m_memoryPeak(0.)
 {
   m_stat.initialize();
 }
@@ -82,8 +87,12 @@ void Run::initialize(int argc, char* argv[])
     if (m_restartSimulation > 0) {
       if (rankCpu == 0) std::cout << "Restarting simulation from result file number: " << m_restartSimulation << "...";
       m_outPut->readInfos();
+      m_restartFromCheckpoint = m_outPut->checkpointAvailable();
       if (m_mesh->getType() == AMR) {
-        if (m_restartSimulation % m_restartAMRsaveFreq == 0) {
+        if (m_restartFromCheckpoint) {
+          m_outPut->readDomainDecompostion(m_mesh, m_restartSimulation, true);
+        }
+        else if (m_restartAMRsaveFreq != 0 && m_restartSimulation % m_restartAMRsaveFreq == 0) {
           m_outPut->readDomainDecompostion(m_mesh, m_restartSimulation);
         }
         else {
@@ -137,7 +146,12 @@ void Run::initialize(int argc, char* argv[])
   //--------------------------
   m_outPut->prepareOutput(*cellLeft);
   for (unsigned int c = 0; c < m_cuts.size(); c++) m_cuts[c]->prepareOutput(*cellLeft);
+  OutputProbeGNU::locateProbesInMesh(m_probes, m_cellsLvl[0], m_mesh->getNumberCells());
   for (unsigned int p = 0; p < m_probes.size(); p++) m_probes[p]->prepareOutput(*cellLeft);
+  for (unsigned int p = 0; p < m_probeArrays.size(); p++) m_probeArrays[p]->prepareOutput(*cellLeft);
+  if (m_diagnostics) m_diagnostics->initialize(m_numberPhases, m_lvlMax, m_outPut->getFolderOutput(), m_restartSimulation > 0);
+  m_stat.initializePerfCounters(m_numTest);
+  m_stat.initializeTrace(m_outPut->getFolderOutput(), &parallel.getOctetsEnvoyes());
 
   //10) Restart simulation
   //----------------------
@@ -152,12 +166,6 @@ void Run::initialize(int argc, char* argv[])
     try {
       //Only for few test cases
       //-----
-      //m_pMax = new double[4];
-      //m_pMaxWall = new double[4];
-      //m_pMax[0] = 0.;
-      //m_pMaxWall[0] = 0.;
-      //for (unsigned int c = 0; c < m_cellsLvl[0].size(); c++) { m_cellsLvl[0][c]->lookForPmax(m_pMax, m_pMaxWall); }
-      //if (Ncpu > 1) { parallel.computePMax(m_pMax[0], m_pMaxWall[0]); }
       // m_massWanted = 0.; //Initial mass
       // m_alphaWanted = -1.;
       // for (unsigned int c = 0; c < m_cellsLvl[0].size(); c++) { m_cellsLvl[0][c]->computeMass(m_massWanted, m_alphaWanted); }
@@ -165,12 +173,20 @@ void Run::initialize(int argc, char* argv[])
       // m_massWanted = 0.9*m_massWanted; //Percentage of the initial mass we want
       // m_alphaWanted = 0.;
       //-----
+      if (m_diagnostics) {
+        m_diagnostics->startStep(m_iteration);
+        for (int lvl = 0; lvl <= m_lvlMax; lvl++) { m_diagnostics->accumulateLeafCells(m_cellsLvl[lvl]); }
+        m_diagnostics->write(m_physicalTime, m_iteration);
+      }
       m_outPut->prepareOutputInfos();
+      this->reportMemory();
       if (rankCpu == 0) m_outPut->ecritInfos();
       m_outPut->saveInfosMailles();
       if (m_mesh->getType() == AMR) m_outPut->printTree(m_mesh, m_cellsLvl, m_restartAMRsaveFreq);
-      for (unsigned int c = 0; c < m_cuts.size(); c++) m_cuts[c]->ecritSolution(m_mesh, m_cellsLvl);
+      m_outPut->writeCheckpoint(m_mesh, m_cellsLvl, m_checkpointFreq);
+      OutputCutGNU::ecritCoupes(m_cuts, m_mesh, m_cellsLvl);
       for (unsigned int p = 0; p < m_probes.size(); p++) { if (m_probes[p]->possesses()) m_probes[p]->ecritSolution(m_mesh, m_cellsLvl); }
+      for (unsigned int p = 0; p < m_probeArrays.size(); p++) { m_probeArrays[p]->ecritSolution(m_mesh, m_cellsLvl); }
       m_outPut->ecritSolution(m_mesh, m_cellsLvl);
     }
     catch (ErrorXML &) { throw; }
@@ -186,12 +202,17 @@ void Run::restartSimulation()
 
   //Reconstruct the mesh and get physical data from restart point
   try {
-    if (m_mesh->getType() == AMR) {
-      if (m_restartSimulation % m_restartAMRsaveFreq == 0) {
-        m_outPut->readTree(m_mesh, m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, m_addPhys, m_model, m_eos, m_nbCellsTotalAMR);
+    if (m_restartFromCheckpoint) {
+      m_outPut->readCheckpoint(m_mesh, m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, m_addPhys, m_model, m_eos, m_nbCellsTotalAMR);
+    }
+    else {
+      if (m_mesh->getType() == AMR) {
+        if (m_restartSimulation % m_restartAMRsaveFreq == 0) {
+          m_outPut->readTree(m_mesh, m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, m_addPhys, m_model, m_eos, m_nbCellsTotalAMR);
+        }
       }
+      m_outPut->readResults(m_mesh, m_cellsLvl);
     }
-    m_outPut->readResults(m_mesh, m_cellsLvl);
   }
   catch (ErrorECOGEN &) { fileStream.close(); throw; }
   fileStream.close();
@@ -203,8 +224,16 @@ void Run::restartSimulation()
       parallel.communicationsTransports(lvl);
     }
   }
-  for (int lvl = 0; lvl <= m_lvlMax; lvl++) { //With reduced output
-    for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { m_cellsLvl[lvl][i]->completeFulfillState(restart); }
+  if (m_restartFromCheckpoint) {
+    //Checkpoints hold the complete states of every level (total energy included): nothing to rebuild (exact restart)
+    for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
+      for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { m_cellsLvl[lvl][i]->prepareAddPhys(); }
+    }
+  }
+  else {
+    for (int lvl = 0; lvl <= m_lvlMax; lvl++) { //With reduced output
+      for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { m_cellsLvl[lvl][i]->completeFulfillState(restart); }
+    }
   }
   // for (int lvl = 0; lvl <= m_lvlMax; lvl++) { //With complete output
   //   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { m_cellsLvl[lvl][i]->fulfillState(restart); }
@@ -217,7 +246,7 @@ void Run::restartSimulation()
   //       }
   //   }
   // }
-  if (m_mesh->getType() == AMR) {
+  if (m_mesh->getType() == AMR && !m_restartFromCheckpoint) {
     for (int lvl = 0; lvl < m_lvlMax; lvl++) {
       for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { m_cellsLvl[lvl][i]->averageChildrenInParent(); }
     }
@@ -242,6 +271,11 @@ void Run::solver()
   //-------------------
   bool computeFini(false); bool print(false);
   double printSuivante(m_physicalTime+m_timeFreq);
+  if (m_telemetry) {
+    m_telemetry->initialize(m_outPut->getFolderOutput(), this->progress(), m_cellUpdates);
+    if (m_restartSimulation == 0) m_telemetry->setLastOutputTime(m_physicalTime);
+  }
+  m_stat.startRegion("time loop");
   while (!computeFini) {
     //Errors checking
     try {
@@ -255,7 +289,11 @@ void Run::solver()
     for (unsigned int i = 0; i < m_cellsLvl[0].size(); i++) { m_cellsLvl[0][i]->setToZeroConsGlobal(m_numberPhases, m_numberTransports); }
     dtMax = 1.e10;
     int lvlDep = 0;
+    if (m_diagnostics) m_diagnostics->startStep(m_iteration + 1);
     this->integrationProcedure(m_dt, lvlDep, dtMax, m_nbCellsTotalAMR);
+    m_stat.startRegion("cell budget");
+    m_mesh->adaptToCellBudget(m_iteration, m_nbCellsTotalAMR, m_numTest);
+    m_stat.endRegion();
     
     //-------------------- CONTROL ITERATIONS/TIME ---------------------
 
@@ -279,15 +317,20 @@ void Run::solver()
     //------------------------ OUTPUT FILES PRINTING -------------------------
     nbCellsTotalAMRMax = std::max(nbCellsTotalAMRMax, m_nbCellsTotalAMR);
     m_dtNext = m_cfl * dtMax;
-    if (Ncpu > 1) { parallel.computeDt(m_dtNext); }
+    if (Ncpu > 1) {
+      m_stat.startRegion("reduction dt");
+      if (m_telemetry) { m_telemetry->computeDt(m_dtNext, m_cellUpdates, m_nbCellsTotalAMR); } //Telemetry counters carried by the same collective
+      else { parallel.computeDt(m_dtNext); }
+      m_stat.endRegion();
+    }
+    else if (m_telemetry) { m_telemetry->computeDt(m_dtNext, m_cellUpdates, m_nbCellsTotalAMR); }
+    m_stat.startRegion("output");
+    if (m_diagnostics && m_diagnostics->isSampling()) { m_diagnostics->write(m_physicalTime, m_iteration); }
     if (print) {
       m_stat.updateComputationTime();
       //General printings
       //Only for few test case
       //-----
-      //if (Ncpu > 1) { parallel.computePMax(m_pMax[0], m_pMaxWall[0]); }
-      //m_pMax[0] = 0.;
-      //m_pMaxWall[0] = 0.;
       // m_alphaWanted = 1.; //Volume fraction corresponding to the wanted mass
       // double mass(0.);
       // do {
@@ -298,11 +341,24 @@ void Run::solver()
       // } while (mass < 0.999*m_massWanted && m_alphaWanted > 0.001);
       // if (m_alphaWanted < 1.e-10) m_alphaWanted = 0.;
       //-----
+      this->reportMemory();
       if (rankCpu == 0) m_outPut->ecritInfos();
       m_outPut->saveInfosMailles();
       if (m_mesh->getType() == AMR) m_outPut->printTree(m_mesh, m_cellsLvl, m_restartAMRsaveFreq);
-      for (unsigned int c = 0; c < m_cuts.size(); c++) { m_cuts[c]->ecritSolution(m_mesh, m_cellsLvl); }
+      m_outPut->writeCheckpoint(m_mesh, m_cellsLvl, m_checkpointFreq);
+      OutputCutGNU::ecritCoupes(m_cuts, m_mesh, m_cellsLvl);
       m_outPut->ecritSolution(m_mesh, m_cellsLvl);
+      m_stat.ecritTrace();
+      if (Ncpu > 1) {
+        //Communication volumes since previous output and halo-to-interior leaf cells ratio
+        int nbCellsInterior(0), nbCellsHalo(0);
+        for (int lvl = 0; lvl <= m_lvlMax; lvl++) {
+          for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { if (!m_cellsLvl[lvl][i]->getSplit()) nbCellsInterior++; }
+          for (unsigned int i = 0; i < m_cellsLvlGhost[lvl].size(); i++) { if (!m_cellsLvlGhost[lvl][i]->getSplit()) nbCellsHalo++; }
+        }
+        parallel.reportCommunications(m_outPut->getFolderOutput() + "infoCommunications.out", m_iteration, nbCellsInterior, nbCellsHalo);
+      }
+      if (m_telemetry) m_telemetry->setLastOutputTime(m_physicalTime);
       if (rankCpu == 0) std::cout << "OK" << std::endl;
       print = false;
     }
@@ -310,12 +366,23 @@ void Run::solver()
     for (unsigned int p = 0; p < m_probes.size(); p++) { 
       if((m_probes[p]->possesses()) && m_probes[p]->getNextTime()<=m_physicalTime) m_probes[p]->ecritSolution(m_mesh, m_cellsLvl);
     }
+    for (unsigned int p = 0; p < m_probeArrays.size(); p++) {
+      if (m_probeArrays[p]->getNextTime() <= m_physicalTime) m_probeArrays[p]->ecritSolution(m_mesh, m_cellsLvl);
+    }
+    if (m_telemetry) m_telemetry->write(m_iteration, m_physicalTime, m_dt, this->progress(), computeFini);
+    m_stat.endRegion();
 
     //-------------------------- TIME STEP UPDATING --------------------------
 
     m_dt = m_dtNext;
 
   } //time iterative loop end
+  m_stat.startRegion("output");
+  m_outPut->termineEcritures();
+  for (unsigned int p = 0; p < m_probes.size(); p++) { m_probes[p]->termineEcritures(); }
+  for (unsigned int p = 0; p < m_probeArrays.size(); p++) { m_probeArrays[p]->termineEcritures(); }
+  m_stat.endRegion();
+  m_stat.endRegion();
   if (rankCpu == 0) std::cout << "T" << m_numTest << " | -------------------------------------------" << std::endl;
   MPI_Barrier(MPI_COMM_WORLD);
   if (m_mesh->getType() == AMR) {
@@ -327,21 +394,38 @@ void Run::solver()
     }
     std::cout << "T" << m_numTest << " | Final local load on CPU " << rankCpu << " : " << localLoad << std::endl;
   }
+  //Wall-clock profile of the time loop reduced over CPUs
+  m_stat.termineTrace();
+  m_stat.printRegionsStats(m_numTest);
+  if (Ncpu > 1) { parallel.printCommunicationsStats(m_outPut->getFolderOutput() + "communicationMatrix.out", m_numTest); }
 }
 
 //***********************************************************************
 
 void Run::integrationProcedure(double &dt, int lvl, double &dtMax, int &nbCellsTotalAMR)
 {
+  RegionScope region(m_stat, "integration", lvl);
+
   //1) AMR Level time step determination
   double dtLvl = dt * std::pow(2., -(double)lvl);
   
   //2) Refinement procedure
   if (m_lvlMax > 0) { 
     m_stat.startAMRTime();
-    m_mesh->procedureRaffinement(m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, lvl, m_addPhys, m_model, nbCellsTotalAMR, m_eos);
+    if (m_mesh->remeshingStep(lvl)) {
+      m_stat.startRegion("refinement");
+      m_mesh->procedureRaffinement(m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, lvl, m_addPhys, m_model, nbCellsTotalAMR, m_eos);
+      m_stat.endRegion();
+      m_nbRemaillages++;
+    }
     if (Ncpu > 1) { if (lvl == 0) { if (m_iteration % (static_cast<int>(1./m_cfl/0.6) + 1) == 0) {
+      m_stat.startRegion("balancing");
       m_mesh->parallelLoadBalancingAMR(m_cellsLvl, m_cellsLvlGhost, m_cellInterfacesLvl, m_order, m_numberPhases, m_numberTransports, m_addPhys, m_model, m_eos, nbCellsTotalAMR);
+      m_nbRemaillages++;
+      //Level 0 cells containing probes may have migrated
+      OutputProbeGNU::locateProbesInMesh(m_probes, m_cellsLvl[0], m_mesh->getNumberCells());
+      for (unsigned int p = 0; p < m_probeArrays.size(); p++) { m_probeArrays[p]->locatePointsInMesh(); }
+      m_stat.endRegion();
     } } }
     m_stat.endAMRTime();
   }
@@ -349,9 +433,11 @@ void Run::integrationProcedure(double &dt, int lvl, double &dtMax, int &nbCellsT
   //3) Slopes determination for second order and gradients for additional physics
   //Fait ici pour avoir une mise a jour d'effectuer lors de l'execution de la procedure de niveau lvl+1 (donc pour les slopes plus besoin de les faire au debut de resolHyperboliqueO2)
   if (m_order == "SECONDORDER") {
+    m_stat.startRegion("slopes");
     for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) { if (!m_cellInterfacesLvl[lvl][i]->getSplit()) { m_cellInterfacesLvl[lvl][i]->computeSlopes(m_numberPhases, m_numberTransports); } }
+    m_stat.endRegion();
     if (Ncpu > 1) {
-      m_stat.startCommunicationTime();
+      m_stat.startCommunicationTime("halo slopes");
       parallel.communicationsSlopes(lvl);
       if (lvl > 0) { parallel.communicationsSlopes(lvl - 1); }
       m_stat.endCommunicationTime();
@@ -359,9 +445,11 @@ void Run::integrationProcedure(double &dt, int lvl, double &dtMax, int &nbCellsT
   }
   if (lvl < m_lvlMax) {
     if (m_numberAddPhys) {
+      m_stat.startRegion("AddPhys gradients");
       for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { if (!m_cellsLvl[lvl][i]->getSplit()) { m_cellsLvl[lvl][i]->prepareAddPhys(); } }
+      m_stat.endRegion();
       if (Ncpu > 1) {
-        m_stat.startCommunicationTime();
+        m_stat.startCommunicationTime("halo AddPhys");
         for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) { m_addPhys[pa]->communicationsAddPhys(m_numberPhases, m_dimension, lvl); }
         m_stat.endCommunicationTime();
       }
@@ -376,9 +464,11 @@ void Run::integrationProcedure(double &dt, int lvl, double &dtMax, int &nbCellsT
   //6) Additional calculations for AMR levels > 0
   if (lvl > 0) {
     if (m_order == "SECONDORDER") {
+      m_stat.startRegion("slopes");
       for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) { if (!m_cellInterfacesLvl[lvl][i]->getSplit()) { m_cellInterfacesLvl[lvl][i]->computeSlopes(m_numberPhases, m_numberTransports); } }
+      m_stat.endRegion();
       if (Ncpu > 1) {
-        m_stat.startCommunicationTime();
+        m_stat.startCommunicationTime("halo slopes");
         parallel.communicationsSlopes(lvl);
         if (lvl > 0) { parallel.communicationsSlopes(lvl - 1); }
         m_stat.endCommunicationTime();
@@ -397,23 +487,24 @@ void Run::advancingProcedure(double &dt, int &lvl, double &dtMax)
   if (m_order == "FIRSTORDER") { this->solveHyperbolic(dt, lvl, dtMax); }
   else { this->solveHyperbolicO2(dt, lvl, dtMax); }
   //2) Finite volume scheme for additional physics
-  if (m_numberAddPhys) this->solveAdditionalPhysics(dt, lvl);
+  if (m_numberAddPhys) { RegionScope region(m_stat, "AddPhys"); this->solveAdditionalPhysics(dt, lvl); }
   //3) Source terms integration before relaxations
-  if (m_numberSources) this->solveSourceTerms(dt, lvl);
-  //4) Relaxations to equilibria
-  if (m_numberPhases > 1) this->solveRelaxations(lvl);
+  if (m_numberSources) { RegionScope region(m_stat, "sources"); this->solveSourceTerms(dt, lvl); }
+  //4) Relaxations to equilibria (diagnostics monitors accumulated in the same sweep)
+  bool accumulateDiagnostics(m_diagnostics && m_diagnostics->accumulateLevel(lvl));
+  if (m_numberPhases > 1) { RegionScope region(m_stat, "relaxation"); this->solveRelaxations(lvl, accumulateDiagnostics); }
+  else if (accumulateDiagnostics) { RegionScope region(m_stat, "diagnostics"); m_diagnostics->accumulateLeafCells(m_cellsLvl[lvl]); }
   //5) Averaging childs cells in mother cell (if AMR)
-  if (lvl < m_lvlMax) { for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { m_cellsLvl[lvl][i]->averageChildrenInParent(); } }
+  if (lvl < m_lvlMax) {
+    RegionScope region(m_stat, "averaging");
+    for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { m_cellsLvl[lvl][i]->averageChildrenInParent(); }
+  }
   //6) Final communications
   if (Ncpu > 1) {
-    m_stat.startCommunicationTime();
+    m_stat.startCommunicationTime("halo primitives");
     parallel.communicationsPrimitives(m_eos, lvl);
     m_stat.endCommunicationTime();
   }
-  //Only for few test case
-  //-----
-  //for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { m_cellsLvl[lvl][i]->lookForPmax(m_pMax, m_pMaxWall); }
-  //-----
 }
 
 //***********************************************************************
@@ -422,15 +513,18 @@ void Run::solveHyperbolicO2(double &dt, int &lvl, double &dtMax)
 {
   //1) m_cons saves for AMR/second order combination
   //------------------------------------------------
+  m_stat.startRegion("flux");
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { if (!m_cellsLvl[lvl][i]->getSplit()) { m_cellsLvl[lvl][i]->saveCons(m_numberPhases, m_numberTransports); } }
 
   //2) Spatial second order scheme
   //------------------------------
   //Fluxes are determined at each cells interfaces and stored in the m_cons variableof corresponding cells. Hyperbolic maximum time step determination
   for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) { if (!m_cellInterfacesLvl[lvl][i]->getSplit()) { m_cellInterfacesLvl[lvl][i]->computeFlux(m_numberPhases, m_numberTransports, dtMax, *m_globalLimiter, *m_interfaceLimiter, *m_globalVolumeFractionLimiter, *m_interfaceVolumeFractionLimiter); } }
+  m_stat.endRegion();
 
   //3)Prediction step using slopes
   //------------------------------
+  m_stat.startRegion("prediction");
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { if (!m_cellsLvl[lvl][i]->getSplit()) { m_cellsLvl[lvl][i]->predictionOrdre2(dt, m_numberPhases, m_numberTransports, m_symmetry); } }
   //3b) Option: Activate relaxation during prediction
   //3c) Option: Activate additional physics during prediction
@@ -439,20 +533,23 @@ void Run::solveHyperbolicO2(double &dt, int &lvl, double &dtMax)
   //4) m_cons recovery for AMR/second order combination (substotute to setToZeroCons)
   //---------------------------------------------------------------------------------
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { if (!m_cellsLvl[lvl][i]->getSplit()) { m_cellsLvl[lvl][i]->recuperationCons(m_numberPhases, m_numberTransports); } }
+  m_stat.endRegion();
 
   //5) vecPhasesO2 communications
   //-----------------------------
   if (Ncpu > 1) {
-    m_stat.startCommunicationTime();
+    m_stat.startCommunicationTime("halo primitives O2");
     parallel.communicationsPrimitives(m_eos, lvl, vecPhasesO2);
     m_stat.endCommunicationTime();
   }
 
   //6) Optional new slopes determination (improves code stability)
   //--------------------------------------------------------------
+  m_stat.startRegion("slopes");
   for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) { if (!m_cellInterfacesLvl[lvl][i]->getSplit()) { m_cellInterfacesLvl[lvl][i]->computeSlopes(m_numberPhases, m_numberTransports, vecPhasesO2); } }
+  m_stat.endRegion();
   if (Ncpu > 1) {
-    m_stat.startCommunicationTime();
+    m_stat.startCommunicationTime("halo slopes");
     parallel.communicationsSlopes(lvl);
     if (lvl > 0) { parallel.communicationsSlopes(lvl - 1); }
     m_stat.endCommunicationTime();
@@ -461,15 +558,19 @@ void Run::solveHyperbolicO2(double &dt, int &lvl, double &dtMax)
   //7) Spatial scheme on predicted variables
   //----------------------------------------
   //Fluxes are determined at each cells interfaces and stored in the m_cons variableof corresponding cells. Hyperbolic maximum time step determination
+  m_stat.startRegion("flux");
   for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) { if (!m_cellInterfacesLvl[lvl][i]->getSplit()) { m_cellInterfacesLvl[lvl][i]->computeFlux(m_numberPhases, m_numberTransports, dtMax, *m_globalLimiter, *m_interfaceLimiter, *m_globalVolumeFractionLimiter, *m_interfaceVolumeFractionLimiter, vecPhasesO2); } }
+  m_stat.endRegion();
 
   //8) Time evolution
   //-----------------
+  RegionScope region(m_stat, "time evolution");
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
     if (!m_cellsLvl[lvl][i]->getSplit()) {
       m_cellsLvl[lvl][i]->timeEvolution(dt, m_numberPhases, m_numberTransports, m_symmetry, vecPhasesO2);   //Obtention des cons pour shema sur (Un+1-Un)/dt
       m_cellsLvl[lvl][i]->buildPrim(m_numberPhases);                                                        //On peut reconstruire Prim a partir de m_cons
       m_cellsLvl[lvl][i]->setToZeroCons(m_numberPhases, m_numberTransports);                                //Mise a zero des cons pour shema spatial sur dU/dt : permet de s affranchir du pas de temps
+      m_cellUpdates++;
     }
   }
 }
@@ -481,15 +582,19 @@ void Run::solveHyperbolic(double &dt, int &lvl, double &dtMax)
   //1) Spatial scheme
   //-----------------
   //Fluxes are determined at each cells interfaces and stored in the m_cons variableof corresponding cells. Hyperbolic maximum time step determination
+  m_stat.startRegion("flux");
   for (unsigned int i = 0; i < m_cellInterfacesLvl[lvl].size(); i++) { if (!m_cellInterfacesLvl[lvl][i]->getSplit()) { m_cellInterfacesLvl[lvl][i]->computeFlux(m_numberPhases, m_numberTransports, dtMax, *m_globalLimiter, *m_interfaceLimiter, *m_globalVolumeFractionLimiter, *m_interfaceVolumeFractionLimiter); } }
+  m_stat.endRegion();
 
   //2) Time evolution
   //-----------------
+  RegionScope region(m_stat, "time evolution");
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
     if (!m_cellsLvl[lvl][i]->getSplit()) {
       m_cellsLvl[lvl][i]->timeEvolution(dt, m_numberPhases, m_numberTransports, m_symmetry);   //Obtention des cons pour shema sur (Un+1-Un)/dt
       m_cellsLvl[lvl][i]->buildPrim(m_numberPhases);                                           //On peut reconstruire Prim a partir de m_cons
       m_cellsLvl[lvl][i]->setToZeroCons(m_numberPhases, m_numberTransports);                   //Mise a zero des cons pour shema spatial sur dU/dt : permet de s affranchir du pas de temps
+      m_cellUpdates++;
     }
   }
 }
@@ -501,13 +606,15 @@ void Run::solveAdditionalPhysics(double &dt, int &lvl)
   //1) Preparation of variables for additional (gradients computations, etc) and communications
   //-------------------------------------------------------------------------------------------
   if (Ncpu > 1) {
-    m_stat.startCommunicationTime();
+    m_stat.startCommunicationTime("halo primitives");
     parallel.communicationsPrimitives(m_eos, lvl);
     m_stat.endCommunicationTime();
   }
+  m_stat.startRegion("AddPhys gradients");
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { if (!m_cellsLvl[lvl][i]->getSplit()) { m_cellsLvl[lvl][i]->prepareAddPhys(); } }
+  m_stat.endRegion();
   if (Ncpu > 1) {
-    m_stat.startCommunicationTime();
+    m_stat.startCommunicationTime("halo AddPhys");
     for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) { m_addPhys[pa]->communicationsAddPhys(m_numberPhases, m_dimension, lvl); }
     m_stat.endCommunicationTime();
   }
@@ -545,7 +652,7 @@ void Run::solveSourceTerms(double &dt, int &lvl)
 
 //***********************************************************************
 
-void Run::solveRelaxations(int &lvl)
+void Run::solveRelaxations(int &lvl, const bool &accumulateDiagnostics)
 {
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { 
     if (!m_cellsLvl[lvl][i]->getSplit()) { 
@@ -557,7 +664,7 @@ void Run::solveRelaxations(int &lvl)
     if (m_addPhys[pa]->reinitializationActivated()) {
       m_addPhys[pa]->reinitializeColorFunction(m_cellsLvl, lvl);
       if (Ncpu > 1) {
-        m_stat.startCommunicationTime();
+        m_stat.startCommunicationTime("halo transports");
         parallel.communicationsTransports(lvl);
         m_stat.endCommunicationTime();
       }
@@ -565,7 +672,7 @@ void Run::solveRelaxations(int &lvl)
   }
   for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) { if (!m_cellsLvl[lvl][i]->getSplit()) { m_cellsLvl[lvl][i]->prepareAddPhys(); } }
   if (Ncpu > 1) {
-    m_stat.startCommunicationTime();
+    m_stat.startCommunicationTime("halo AddPhys");
     for (unsigned int pa = 0; pa < m_addPhys.size(); pa++) { m_addPhys[pa]->communicationsAddPhys(m_numberPhases, m_dimension, lvl); }
     m_stat.endCommunicationTime();
   }
@@ -574,12 +681,21 @@ void Run::solveRelaxations(int &lvl)
     if (!m_cellsLvl[lvl][i]->getSplit()) {
       m_cellsLvl[lvl][i]->correctionEnergy(m_numberPhases);               //Correction des energies
       //if (m_evaporation) m_cellsLvl[lvl][i]->relaxPTMu(m_numberPhases); //Relaxation des pressures, temperatures et potentiels chimiques
+      if (accumulateDiagnostics) m_diagnostics->accumulate(m_cellsLvl[lvl][i]);
     }
   }
 }
 
 //***********************************************************************
 
+double Run::progress() const
+{
+  if (m_controleIterations) { return std::min(1., static_cast<double>(m_iteration) / static_cast<double>(m_nbIte)); }
+  return std::min(1., m_physicalTime / m_finalPhysicalTime);
+}
+
+//***********************************************************************
+
 void Run::verifyErrors() const
 {
   try {
@@ -598,8 +714,122 @@ void Run::verifyErrors() const
 
 //***********************************************************************
 
+void Run::reportMemory()
+{
+  static const char* nameTypeMemory[nbTypesMemory] = { "cells", "phases", "mixtures", "fluxes", "transports", "addPhys", "slopes", "interfaces", "faces", "elements", "ghosts", "parallel" };
+
+  //Local accounting per level and category (index lvl*nbTypesMemory + type)
+  int nbLvl(m_lvlMax + 1), taille(nbLvl*nbTypesMemory);
+  std::vector<double> octets(nbTypesMemory), octetsGhost(nbTypesMemory);
+  std::vector<double> local(taille + 2 * nbLvl + 1, 0.);
+  for (int lvl = 0; lvl < nbLvl; lvl++) {
+    std::fill(octets.begin(), octets.end(), 0.);
+    std::fill(octetsGhost.begin(), octetsGhost.end(), 0.);
+    int nbLeafCells(0);
+    for (unsigned int i = 0; i < m_cellsLvl[lvl].size(); i++) {
+      m_cellsLvl[lvl][i]->computeMemory(octets);
+      if (!m_cellsLvl[lvl][i]->getSplit()) nbLeafCells++;
+    }
+    for (unsigned int b = 0; b < m_cellInterfacesLvl[lvl].size(); b++) { m_cellInterfacesLvl[lvl][b]->computeMemory(octets); }
+    octets[memCells] += m_cellsLvl[lvl].capacity() * sizeof(Cell*);
+    octets[memCellInterfaces] += m_cellInterfacesLvl[lvl].capacity() * sizeof(CellInterface*);
+    //Ghost cells are accounted as a whole (their variables, element and slopes included)
+    for (unsigned int i = 0; i < m_cellsLvlGhost[lvl].size(); i++) { m_cellsLvlGhost[lvl][i]->computeMemory(octetsGhost); }
+    octets[memGhosts] += m_cellsLvlGhost[lvl].capacity() * sizeof(Cell*);
+    for (int t = 0; t < nbTypesMemory; t++) { octets[memGhosts] += octetsGhost[t]; }
+    for (int t = 0; t < nbTypesMemory; t++) { local[lvl*nbTypesMemory + t] = octets[t]; }
+    local[taille + lvl] = nbLeafCells;
+    local[taille + nbLvl + lvl] = m_cellsLvl[lvl].size();
+  }
+  if (Ncpu > 1) {
+    std::vector<double> octetsParallel(taille, 0.);
+    parallel.computeMemory(octetsParallel);
+    for (int lvl = 0; lvl < nbLvl; lvl++) { local[lvl*nbTypesMemory + memParallel] += octetsParallel[lvl*nbTypesMemory + memParallel]; }
+  }
+  local[taille + 2 * nbLvl] = static_cast<double>(Tools::peakMemory());
+
+  //Gathering on CPU 0 (per CPU, per level and per category)
+  std::vector<double> global(Ncpu * local.size());
+  MPI_Gather(&local[0], local.size(), MPI_DOUBLE, &global[0], local.size(), MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  if (rankCpu != 0) return;
+
+  std::vector<double> parLvl(taille, 0.), parCpu(Ncpu*(nbTypesMemory + 3), 0.);
+  double total(0.), nbLeafTotal(0.);
+  int cpuPic(0);
+  m_memoryPeak = 0.;
+  for (int p = 0; p < Ncpu; p++) {
+    const double *g = &global[p*local.size()];
+    double *c = &parCpu[p*(nbTypesMemory + 3)];
+    for (int lvl = 0; lvl < nbLvl; lvl++) {
+      for (int t = 0; t < nbTypesMemory; t++) {
+        parLvl[lvl*nbTypesMemory + t] += g[lvl*nbTypesMemory + t];
+        c[t] += g[lvl*nbTypesMemory + t];
+        c[nbTypesMemory] += g[lvl*nbTypesMemory + t];
+      }
+      c[nbTypesMemory + 1] += g[taille + lvl];
+    }
+    c[nbTypesMemory + 2] = g[taille + 2 * nbLvl];
+    total += c[nbTypesMemory];
+    nbLeafTotal += c[nbTypesMemory + 1];
+    if (c[nbTypesMemory + 2] > m_memoryPeak) { m_memoryPeak = c[nbTypesMemory + 2]; cpuPic = p; }
+  }
+  m_memoryAccounted = total;
+  m_memoryPerLeafCell = (nbLeafTotal > 0. ? total / nbLeafTotal : 0.);
+
+  std::ofstream fileStream((m_outPut->getFolderOutput() + "infoMemory.out").c_str(), m_memoryReports == 0 ? std::ios::out | std::ios::trunc : std::ios::app);
+  m_memoryReports++;
+  fileStream << "Iteration " << m_iteration << " / Physical time " << m_physicalTime << " s" << std::endl;
+  //Per level (summed over CPUs)
+  fileStream << std::left << std::setw(12) << "bytes" << std::right;
+  for (int lvl = 0; lvl < nbLvl; lvl++) { fileStream << std::setw(14) << "lvl " + IO::toString(lvl); }
+  fileStream << std::setw(16) << "total" << std::setw(14) << "per leaf" << std::endl;
+  std::vector<double> totalLvl(nbLvl, 0.);
+  fileStream << std::fixed;
+  for (int t = 0; t < nbTypesMemory; t++) {
+    double totalType(0.);
+    fileStream << std::left << std::setw(12) << nameTypeMemory[t] << std::right << std::setprecision(0);
+    for (int lvl = 0; lvl < nbLvl; lvl++) {
+      fileStream << std::setw(14) << parLvl[lvl*nbTypesMemory + t];
+      totalType += parLvl[lvl*nbTypesMemory + t];
+      totalLvl[lvl] += parLvl[lvl*nbTypesMemory + t];
+    }
+    fileStream << std::setw(16) << totalType << std::setprecision(1) << std::setw(14) << (nbLeafTotal > 0. ? totalType / nbLeafTotal : 0.) << std::endl;
+  }
+  fileStream << std::left << std::setw(12) << "total" << std::right << std::setprecision(0);
+  for (int lvl = 0; lvl < nbLvl; lvl++) { fileStream << std::setw(14) << totalLvl[lvl]; }
+  fileStream << std::setw(16) << total << std::setprecision(1) << std::setw(14) << m_memoryPerLeafCell << std::endl;
+  fileStream << std::left << std::setw(12) << "cells" << std::right << std::setprecision(0);
+  for (int lvl = 0; lvl < nbLvl; lvl++) {
+    double nbCells(0.);
+    for (int p = 0; p < Ncpu; p++) { nbCells += global[p*local.size() + taille + nbLvl + lvl]; }
+    fileStream << std::setw(14) << nbCells;
+  }
+  fileStream << std::setw(16) << nbLeafTotal << " leaf cells" << std::endl;
+  //Per CPU (all levels)
+  fileStream << std::left << std::setw(12) << "CPU" << std::right;
+  for (int t = 0; t < nbTypesMemory; t++) { fileStream << std::setw(12) << nameTypeMemory[t]; }
+  fileStream << std::setw(14) << "total" << std::setw(12) << "leaf cells" << std::setw(12) << "per leaf" << std::setw(14) << "peak RSS" << std::endl;
+  for (int p = 0; p < Ncpu; p++) {
+    const double *c = &parCpu[p*(nbTypesMemory + 3)];
+    fileStream << std::left << std::setw(12) << p << std::right << std::setprecision(0);
+    for (int t = 0; t < nbTypesMemory; t++) { fileStream << std::setw(12) << c[t]; }
+    fileStream << std::setw(14) << c[nbTypesMemory] << std::setw(12) << c[nbTypesMemory + 1] << std::setprecision(1)
+      << std::setw(12) << (c[nbTypesMemory + 1] > 0. ? c[nbTypesMemory] / c[nbTypesMemory + 1] : 0.) << std::setprecision(0) << std::setw(14) << c[nbTypesMemory + 2] << std::endl;
+  }
+  fileStream << "peak RSS watermark: " << m_memoryPeak << " bytes (CPU " << cpuPic << ")";
+  if (m_memoryPeak > 0.) fileStream << ", accounted/peak RSS of this CPU: " << std::setprecision(3) << parCpu[cpuPic*(nbTypesMemory + 3) + nbTypesMemory] / m_memoryPeak;
+  fileStream << std::endl << std::endl;
+}
+
+//***********************************************************************
+
 void Run::finalize()
 {
+  //Results files still being written in background
+  try { m_outPut->termineEcritures(); }
+  catch (ErrorECOGEN &e) { std::cerr << e.infoError() << std::endl; }
+  for (unsigned int p = 0; p < m_probes.size(); p++) { m_probes[p]->termineEcritures(); }
+  for (unsigned int p = 0; p < m_probeArrays.size(); p++) { m_probeArrays[p]->termineEcritures(); }
   //Global desallocations
   for (int i = 0; i < m_cellInterfacesLvl[0].size(); i++) { delete m_cellInterfacesLvl[0][i]; }
   for (int i = 0; i < m_cellsLvl[0].size(); i++) { delete m_cellsLvl[0][i]; }
@@ -630,6 +860,10 @@ void Run::finalize()
   delete m_input; 
   delete m_outPut;
   for (unsigned int s = 0; s < m_cuts.size(); s++) { delete m_cuts[s]; }
+  for (unsigned int p = 0; p < m_probes.size(); p++) { delete m_probes[p]; }
+  for (unsigned int p = 0; p < m_probeArrays.size(); p++) { delete m_probeArrays[p]; }
+  if (m_diagnostics) delete m_diagnostics;
+  if (m_telemetry) delete m_telemetry;
   //Desallocations AMR
   delete[] m_cellsLvl;
   delete[] m_cellInterfacesLvl;
@@ -36,6 +36,7 @@
 //! \date      June 5 2019
 
 class Run;
+class OutputProbeArray;
 
 #include <iostream>
 #include <fstream>
@@ -61,7 +62,9 @@ class Run;
 
 #include "InputOutput/Input.h"
 #include "InputOutput/Output.h"
+#include "InputOutput/Telemetry.h"
 #include "timeStats.h"
+#include "Diagnostics/Diagnostics.h"
 
 #include "Relaxations/HeaderRelaxations.h"
 
@@ -96,8 +99,14 @@ class Run
     void solveHyperbolicO2(double &dt, int &lvl, double &dtMax);
     void solveAdditionalPhysics(double &dt, int &lvl);
     void solveSourceTerms(double &dt, int &lvl);
-    void solveRelaxations(int &lvl);
+    //! \brief    Relaxations to equilibria of the leaf cells of the level
+    //! \param    accumulateDiagnostics   true to accumulate the diagnostics monitors in the final sweep
+    void solveRelaxations(int &lvl, const bool &accumulateDiagnostics);
     void verifyErrors() const;
+    //! \brief    Progress of the run between 0 and 1 (iterations or physical time depending on the time control mode)
+    double progress() const;
+    //! \brief    Memory accounting per subsystem, level and CPU, written to infoMemory.out at each output (collective)
+    void reportMemory();
 
     int m_numTest;                             //!<Number of the simulation
 
@@ -145,24 +154,35 @@ class Run
     double m_dtNext;                           //!<Next time step
     double m_physicalTime;                     //!<Physical time
     int m_iteration;                           //!<time iteration number
+    int m_nbRemaillages;                       //!<Number of remeshings and load balancings done (AMR leaves located before are no more valid)
+    long long m_cellUpdates;                   //!<Number of leaf cell time evolutions done by the CPU (AMR sub-steps included)
     int m_restartSimulation;                   //!<File number for restarting a simulation
     int m_restartAMRsaveFreq;                  //!<Frequency at which a save to restart a simulation is done (usefull only for AMR)
+    int m_checkpointFreq;                      //!<Frequency (in results files) at which binary checkpoints are written (0: no checkpoint)
+    bool m_restartFromCheckpoint;              //!<Restart from binary checkpoints (available for the restart file number on every CPU)
 
     //Input/Output attributes
 	Input* m_input;						       //!<Input object
     Output* m_outPut;                          //!<Main output object
     std::vector<Output *> m_cuts;              //!<Vector of output objects for cuts
     std::vector<Output *> m_probes;            //!<Vector of output objects for probes
+    std::vector<OutputProbeArray *> m_probeArrays; //!<Vector of output objects for probe arrays
     timeStats m_stat;                          //!<Object linked to computational time statistics
-    double *m_pMax, *m_pMaxWall;               //!<Maximal pressure found between each written output and its corresponding coordinate (only for few test cases)
+    Diagnostics *m_diagnostics;                //!<In-situ global monitors (NULL if not declared)
+    Telemetry *m_telemetry;                    //!<Live status file for job monitors (NULL if not declared)
     double m_massWanted, m_alphaWanted;        //!<Mass and corresponding volume fraction for special output (only for few test cases)
+    int m_memoryReports;                       //!<Number of memory reports already written in infoMemory.out
+    double m_memoryAccounted, m_memoryPerLeafCell, m_memoryPeak; //!<Last memory report: accounted bytes (all CPUs), accounted bytes per leaf cell and maximum peak RSS over CPUs
 
     friend class Input;
     friend class Output;
     friend class OutputXML;
     friend class OutputGNU;
     friend class OutputProbeGNU;
+    friend class OutputProbeArray;
     friend class Mesh;
+    friend class ScalingBenchmark;
+    friend class RegressionRunner;
 };
 
 #endif // RUN_H
@@ -32,6 +32,9 @@
 //! \version   1.0
 //! \date      December 6 2018
 
+#ifndef WIN32
+  #include <sys/resource.h>
+#endif
 #include "Tools.h"
 
 Tools *TB;
@@ -102,4 +105,21 @@ double Tools::pi()
   return 3.14159;
 }
 
-//***********************************************************************
\ No newline at end of file
+//***********************************************************************
+
+long long Tools::peakMemory()
+{
+#ifdef WIN32
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+  #ifdef __APPLE__
+    return static_cast<long long>(usage.ru_maxrss);        //bytes
+  #else
+    return static_cast<long long>(usage.ru_maxrss) * 1024; //kilobytes
+  #endif
+#endif
+}
+
+//***********************************************************************
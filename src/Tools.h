@@ -52,6 +52,8 @@ typedef enum TypeGO { VERTEX, LINE, PLAN } TypeGO;
 //! \brief     Template for the type of the mesh container (std::list for now, but may change to something else if wanted)
 template<class Type>
 using TypeMeshContainer=std::vector<Type>;
+//! \brief     Enumeration for the categories of the memory accounting (bytes per subsystem, see Run::reportMemory)
+typedef enum TypeMemory { memCells, memPhases, memMixtures, memFluxes, memTransports, memAddPhys, memSlopes, memCellInterfaces, memFaces, memElements, memGhosts, memParallel, nbTypesMemory } TypeMemory;
 
 //! \class     Tools
 //! \brief     Class for tools
@@ -69,6 +71,8 @@ class Tools
     static void uppercase(std::string &string);
     //! \brief     Return the value of pi
     static double pi();
+    //! \brief     Return the peak resident memory of the process (bytes, 0 if not available)
+    static long long peakMemory();
 
     double m_numberPhases;
     double* ak;
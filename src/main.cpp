@@ -33,6 +33,8 @@
 //! \date      June 5 2019
 
 #include "Run.h"
+#include "Benchmarks/ScalingBenchmark.h"
+#include "Benchmarks/RegressionRunner.h"
 #include "Errors.h"
 #include "libTierces/tinyxml2.h"
 
@@ -46,8 +48,10 @@ int main(int argc, char* argv[])
 {
   Run* run(0);
 
-  //Parallel initialization
-  MPI_Init(&argc, &argv);
+  //Parallel initialization (only the main thread communicates, the results writer thread does not)
+  //The provided level is checked by OutputXML, which falls back to synchronous writing below MPI_THREAD_FUNNELED
+  int threadSupport;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &threadSupport);
   MPI_Comm_rank(MPI_COMM_WORLD, &rankCpu);
   MPI_Comm_size(MPI_COMM_WORLD, &Ncpu);
 
@@ -116,9 +120,44 @@ int main(int argc, char* argv[])
     }
     elementTestCase = elementTestCase->NextSiblingElement("testCase");
   }//End of the loop on test cases
+
+  //Loop on the scaling benchmarks to execute (generated test cases)
+  //----------------------------------------------------------------
+  XMLElement *elementBenchmark = xmlNode->FirstChildElement("scalingBenchmark");
+  while (elementBenchmark != NULL) {
+    try {
+      numTestCase++;
+      ScalingBenchmark benchmark(elementBenchmark, fileName.str(), numTestCase);
+      if (rankCpu == 0) {
+        std::cout << "           EXECUTION OF THE TEST CASE NUMBER: " << numTestCase << std::endl;
+        std::cout << "************************************************************" << std::endl;
+      }
+      benchmark.execute(argc, argv);
+    }
+    catch (ErrorECOGEN &e) {
+      if (rankCpu == 0) std::cerr << e.infoError() << std::endl;
+    }
+    elementBenchmark = elementBenchmark->NextSiblingElement("scalingBenchmark");
+  }
+
+  //Loop on the regression tests to execute (manifests of test cases compared to their baselines)
+  //---------------------------------------------------------------------------------------------
+  int codeRetour(0);
+  XMLElement *elementRegression = xmlNode->FirstChildElement("regression");
+  while (elementRegression != NULL) {
+    try {
+      RegressionRunner regression(elementRegression, fileName.str());
+      if (!regression.execute(argc, argv, numTestCase)) codeRetour = 1;
+    }
+    catch (ErrorECOGEN &e) {
+      if (rankCpu == 0) std::cerr << e.infoError() << std::endl;
+      codeRetour = 1;
+    }
+    elementRegression = elementRegression->NextSiblingElement("regression");
+  }
   MPI_Barrier(MPI_COMM_WORLD);
   MPI_Finalize();
-  return 0;
+  return codeRetour;
 }
 
 //***********************************************************************
@@ -0,0 +1,119 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+//! \file      perfCounters.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+#include "perfCounters.h"
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+//***********************************************************************
+
+perfCounters::perfCounters() : m_actif(false), m_fdLeader(-1), m_nbOuverts(0)
+{
+  for (int c = 0; c < nbCompteurs; c++) { m_fd[c] = -1; m_position[c] = -1; }
+}
+
+//***********************************************************************
+
+perfCounters::~perfCounters()
+{
+#ifdef __linux__
+  for (int c = 0; c < nbCompteurs; c++) { if (m_fd[c] >= 0) close(m_fd[c]); }
+#endif
+}
+
+//***********************************************************************
+
+bool perfCounters::initialize()
+{
+#ifdef __linux__
+  const unsigned int types[nbCompteurs] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE };
+  const unsigned long long configs[nbCompteurs] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+  for (int c = 0; c < nbCompteurs; c++) {
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = types[c];
+    attr.config = configs[c];
+    attr.disabled = (c == 0);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    m_fd[c] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, m_fdLeader, 0));
+    if (m_fd[c] < 0) {
+      if (c == 0) return false; //No cycles: counters disabled
+      continue;
+    }
+    if (c == 0) m_fdLeader = m_fd[c];
+    m_position[c] = m_nbOuverts++;
+  }
+  ioctl(m_fdLeader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(m_fdLeader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  m_actif = true;
+#endif
+  return m_actif;
+}
+
+//***********************************************************************
+
+void perfCounters::lecture(long long *valeurs) const
+{
+  for (int c = 0; c < nbCompteurs; c++) { valeurs[c] = 0; }
+#ifdef __linux__
+  if (!m_actif) return;
+  //Group read: number of counters followed by their values
+  unsigned long long buffer[1 + nbCompteurs];
+  if (read(m_fdLeader, buffer, sizeof(buffer)) <= 0) return;
+  for (int c = 0; c < nbCompteurs; c++) {
+    if (m_position[c] >= 0 && static_cast<unsigned long long>(m_position[c]) < buffer[0]) valeurs[c] = static_cast<long long>(buffer[1 + m_position[c]]);
+  }
+#endif
+}
+
+//***********************************************************************
+
+const char* perfCounters::nom(const int &c)
+{
+  static const char* noms[nbCompteurs] = { "cycles", "instructions", "L1D-read-misses", "LLC-misses", "branch-misses" };
+  return noms[c];
+}
+
+//***********************************************************************
@@ -0,0 +1,68 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+//! \file      perfCounters.h
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+
+//! \class     perfCounters
+//! \brief     Hardware performance counters of the calling thread (Linux perf_event_open)
+//! \details   The counters are opened as one group (read with a single system call) and only count user space,
+//!            which is allowed without root while /proc/sys/kernel/perf_event_paranoid <= 2.
+//!            When the leader (cycles) can not be opened, the counters are disabled; other unavailable events are reported as such.
+class perfCounters
+{
+  public:
+    perfCounters();
+    ~perfCounters();
+
+    //! \brief     Open and start the counters
+    //! \return    true if at least the cycles can be counted
+    bool initialize();
+    //! \brief     Read the current values of every counter (0 for unavailable ones)
+    void lecture(long long *valeurs) const;
+    bool estActif() const { return m_actif; };
+    bool estDisponible(const int &c) const { return m_position[c] >= 0; };
+    static const char* nom(const int &c);
+
+    static const int nbCompteurs = 5;     //!<Cycles, instructions, L1 data cache read misses, last level cache misses, branch misses
+
+  private:
+    bool m_actif;                         //!<Counters opened and running
+    int m_fdLeader;                       //!<File descriptor of the group leader (cycles)
+    int m_fd[nbCompteurs];                //!<File descriptors (-1 if not available)
+    int m_position[nbCompteurs];          //!<Position of each counter in the group read (-1 if not available)
+    int m_nbOuverts;                      //!<Number of counters in the group
+};
+
+#endif // PERFCOUNTERS_H
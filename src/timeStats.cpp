@@ -34,10 +34,14 @@
 
 #include "timeStats.h"
 #include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdio>
+#include <algorithm>
 
 //***********************************************************************
 
-timeStats::timeStats(){}
+timeStats::timeStats() : m_perfDemande(false), m_perfActif(false), m_capaciteTrace(0), m_octets(0), m_premierEvenement(true) {}
 
 //***********************************************************************
 
@@ -47,18 +51,33 @@ timeStats::~timeStats(){}
 
 void timeStats::initialize()
 {
-  m_InitialTime = clock();
-  m_computationTime = 0;
-  m_AMRTime = 0;
-  m_communicationTime = 0;
+  m_InitialTime = Horloge::now();
+  m_computationTime = 0.;
+  m_AMRTime = 0.;
+  m_communicationTime = 0.;
+  m_regionCommunication = false;
+  //Root of the regions tree
+  m_regions.clear();
+  m_regions.push_back(RegionProfil());
+  m_regions[0].m_nom = "ECOGEN";
+  m_regions[0].m_lvl = -1;
+  m_regions[0].m_lvlContexte = -1;
+  m_regions[0].m_parent = -1;
+  m_regions[0].m_temps = 0.;
+  m_regions[0].m_appels = 0;
+  m_regions[0].m_debut = m_InitialTime;
+  m_regions[0].m_octetsDebut = 0;
+  for (int c = 0; c < perfCounters::nbCompteurs; c++) { m_regions[0].m_compteurs[c] = 0; }
+  m_regionCourante = 0;
 }
 
 //***********************************************************************
 
 void timeStats::updateComputationTime()
 {
-  m_computationTime += (clock() - m_InitialTime);
-  m_InitialTime = clock();
+  Horloge::time_point now(Horloge::now());
+  m_computationTime += duree(m_InitialTime, now);
+  m_InitialTime = now;
 }
 
 //***********************************************************************
@@ -66,7 +85,7 @@ void timeStats::updateComputationTime()
 void timeStats::startAMRTime()
 {
   MPI_Barrier(MPI_COMM_WORLD);
-  m_AMRRefTime = clock();
+  m_AMRRefTime = Horloge::now();
 }
 
 //***********************************************************************
@@ -74,28 +93,347 @@ void timeStats::startAMRTime()
 void timeStats::endAMRTime()
 {
   MPI_Barrier(MPI_COMM_WORLD);
-  m_AMRTime += (clock() - m_AMRRefTime);
+  m_AMRTime += duree(m_AMRRefTime, Horloge::now());
 }
 
 //***********************************************************************
 
-void timeStats::startCommunicationTime()
+void timeStats::startCommunicationTime(const char* region, const int &lvl)
 {
   MPI_Barrier(MPI_COMM_WORLD);
-  m_communicationRefTime = clock();
+  m_communicationRefTime = Horloge::now();
+  //The region only measures the exchange itself (barriers excluded)
+  m_regionCommunication = (region != 0);
+  if (m_regionCommunication) { this->startRegion(region, lvl); }
 }
 
 //***********************************************************************
 
 void timeStats::endCommunicationTime()
 {
+  if (m_regionCommunication) { this->endRegion(); m_regionCommunication = false; }
   MPI_Barrier(MPI_COMM_WORLD);
-  m_communicationTime += (clock() - m_communicationRefTime);
+  m_communicationTime += duree(m_communicationRefTime, Horloge::now());
 }
 
 //***********************************************************************
 
-void timeStats::setCompTime(const clock_t &compTime, const clock_t &AMRTime, const clock_t &comTime)
+void timeStats::startRegion(const char* name, const int &lvl)
+{
+  //Looking for the region among the ones already nested in the current region
+  const std::vector<int> &enfants(m_regions[m_regionCourante].m_enfants);
+  int r(-1);
+  for (unsigned int e = 0; e < enfants.size(); e++) {
+    if (m_regions[enfants[e]].m_lvl == lvl && m_regions[enfants[e]].m_nom == name) { r = enfants[e]; break; }
+  }
+  if (r < 0) {
+    r = m_regions.size();
+    m_regions.push_back(RegionProfil());
+    m_regions[r].m_nom = name;
+    m_regions[r].m_lvl = lvl;
+    m_regions[r].m_lvlContexte = (lvl >= 0 ? lvl : m_regions[m_regionCourante].m_lvlContexte);
+    m_regions[r].m_parent = m_regionCourante;
+    m_regions[r].m_temps = 0.;
+    m_regions[r].m_appels = 0;
+    for (int c = 0; c < perfCounters::nbCompteurs; c++) { m_regions[r].m_compteurs[c] = 0; }
+    m_regions[m_regionCourante].m_enfants.push_back(r);
+  }
+  m_regionCourante = r;
+  if (m_octets) m_regions[r].m_octetsDebut = *m_octets;
+  if (m_perfActif) m_perf.lecture(m_regions[r].m_compteursDebut);
+  m_regions[r].m_debut = Horloge::now();
+}
+
+//***********************************************************************
+
+void timeStats::endRegion()
+{
+  Horloge::time_point fin(Horloge::now());
+  RegionProfil &region(m_regions[m_regionCourante]);
+  region.m_temps += duree(region.m_debut, fin);
+  region.m_appels++;
+  if (m_perfActif) {
+    long long compteurs[perfCounters::nbCompteurs];
+    m_perf.lecture(compteurs);
+    for (int c = 0; c < perfCounters::nbCompteurs; c++) { region.m_compteurs[c] += compteurs[c] - region.m_compteursDebut[c]; }
+  }
+  if (m_capaciteTrace > 0 && m_fichierTrace.is_open()) {
+    EvenementTrace evenement;
+    evenement.m_region = m_regionCourante;
+    evenement.m_debut = 1.e6 * duree(m_origineTrace, region.m_debut);
+    evenement.m_duree = 1.e6 * duree(region.m_debut, fin);
+    evenement.m_octets = (m_octets ? *m_octets - region.m_octetsDebut : 0);
+    m_evenements.push_back(evenement);
+    //Buffer full before the next output time
+    if (static_cast<int>(m_evenements.size()) >= m_capaciteTrace) this->ecritTrace();
+  }
+  m_regionCourante = region.m_parent;
+}
+
+//***********************************************************************
+
+void timeStats::initializePerfCounters(const int &numTest)
+{
+  if (!m_perfDemande) return;
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  int disponibles[1 + perfCounters::nbCompteurs], disponiblesPartout[1 + perfCounters::nbCompteurs];
+  disponibles[0] = m_perf.initialize();
+  for (int c = 0; c < perfCounters::nbCompteurs; c++) { disponibles[1 + c] = (m_perf.estActif() && m_perf.estDisponible(c)); }
+  MPI_Allreduce(disponibles, disponiblesPartout, 1 + perfCounters::nbCompteurs, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  m_perfActif = (disponiblesPartout[0] != 0);
+  for (int c = 0; c < perfCounters::nbCompteurs; c++) { m_perfDisponible[c] = (disponiblesPartout[1 + c] != 0); }
+  if (rank == 0) {
+    if (m_perfActif) {
+      std::cout << "T" << numTest << " | Hardware counters enabled:";
+      for (int c = 0; c < perfCounters::nbCompteurs; c++) { if (m_perfDisponible[c]) std::cout << " " << perfCounters::nom(c); }
+      std::cout << std::endl;
+    }
+    else { std::cout << "T" << numTest << " | Hardware counters not available (perf_event_open refused, see /proc/sys/kernel/perf_event_paranoid): disabled" << std::endl; }
+  }
+}
+
+//***********************************************************************
+
+void timeStats::initializeTrace(const std::string &folder, const long long *octets)
+{
+  if (m_capaciteTrace <= 0) return;
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  m_octets = octets;
+  m_dossierTrace = folder;
+  m_evenements.reserve(m_capaciteTrace);
+  std::ostringstream nom;
+  nom << m_dossierTrace << "trace_CPU" << rank << ".json";
+  m_fichierTrace.open(nom.str().c_str(), std::ios::out | std::ios::trunc);
+  //Process name displayed by the trace viewers
+  m_fichierTrace << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":0,\"args\":{\"name\":\"CPU " << rank << "\"}}";
+  m_premierEvenement = false;
+  //Common origin of the timelines
+  MPI_Barrier(MPI_COMM_WORLD);
+  m_origineTrace = Horloge::now();
+}
+
+//***********************************************************************
+
+void timeStats::ecritTrace()
+{
+  if (!m_fichierTrace.is_open()) return;
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  char ligne[256];
+  for (unsigned int e = 0; e < m_evenements.size(); e++) {
+    const EvenementTrace &evenement(m_evenements[e]);
+    const RegionProfil &region(m_regions[evenement.m_region]);
+    int n = snprintf(ligne, sizeof(ligne), "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":0,\"args\":{\"lvl\":%d,\"bytes\":%lld}}",
+      (m_premierEvenement ? "" : ","), region.m_nom.c_str(), evenement.m_debut, evenement.m_duree, rank, region.m_lvlContexte, evenement.m_octets);
+    m_fichierTrace.write(ligne, std::min(n, static_cast<int>(sizeof(ligne)) - 1));
+    m_premierEvenement = false;
+  }
+  m_fichierTrace.flush();
+  m_evenements.clear();
+}
+
+//***********************************************************************
+
+void timeStats::termineTrace()
+{
+  if (!m_fichierTrace.is_open()) return;
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  this->ecritTrace();
+  m_fichierTrace.close();
+  MPI_Barrier(MPI_COMM_WORLD);
+  //Merging of the CPU timelines into a single JSON array (one pid per CPU)
+  if (rank == 0) {
+    std::ofstream fichier((m_dossierTrace + "timeline.json").c_str(), std::ios::out | std::ios::trunc);
+    fichier << "[\n";
+    for (int p = 0; p < size; p++) {
+      std::ostringstream nom;
+      nom << m_dossierTrace << "trace_CPU" << p << ".json";
+      std::ifstream fichierCpu(nom.str().c_str());
+      if (p > 0) fichier << ",\n";
+      fichier << fichierCpu.rdbuf();
+      fichierCpu.close();
+      std::remove(nom.str().c_str());
+    }
+    fichier << "\n]\n";
+  }
+}
+
+//***********************************************************************
+
+void timeStats::printRegionsStats(const int &numTest) const
+{
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  //1) Serialization of the local regions in depth-first order: path, time and number of calls
+  std::ostringstream local;
+  local.precision(17);
+  std::vector<int> pile(1, 0);
+  while (!pile.empty()) {
+    int r(pile.back()); pile.pop_back();
+    for (int e = static_cast<int>(m_regions[r].m_enfants.size()) - 1; e >= 0; e--) { pile.push_back(m_regions[r].m_enfants[e]); }
+    if (r == 0) continue;
+    std::string chemin;
+    this->cheminRegion(r, chemin);
+    local << chemin << "\t" << m_regions[r].m_temps << "\t" << m_regions[r].m_appels;
+    if (m_perfActif) { for (int c = 0; c < perfCounters::nbCompteurs; c++) { local << "\t" << m_regions[r].m_compteurs[c]; } }
+    local << "\n";
+  }
+  std::string chaine(local.str());
+
+  //2) Gathering on CPU 0
+  int taille(chaine.size());
+  std::vector<int> tailles(size), deplacements(size, 0);
+  MPI_Gather(&taille, 1, MPI_INT, &tailles[0], 1, MPI_INT, 0, MPI_COMM_WORLD);
+  std::vector<char> recu;
+  if (rank == 0) {
+    for (int p = 1; p < size; p++) { deplacements[p] = deplacements[p - 1] + tailles[p - 1]; }
+    recu.resize(deplacements[size - 1] + tailles[size - 1] + 1);
+  }
+  MPI_Gatherv(const_cast<char*>(chaine.data()), taille, MPI_CHAR, rank == 0 ? &recu[0] : 0, &tailles[0], &deplacements[0], MPI_CHAR, 0, MPI_COMM_WORLD);
+  if (rank != 0) return;
+
+  //3) Merging: a region missing on a CPU counts for zero on it. New regions are inserted after the last descendant of their parent
+  struct Ligne { std::string chemin; double min, somme, max; long appels; int nbCpu; double compteurs[perfCounters::nbCompteurs]; };
+  std::vector<Ligne> lignes;
+  for (int p = 0; p < size; p++) {
+    std::istringstream flux(std::string(&recu[deplacements[p]], tailles[p]));
+    std::string ligne;
+    while (std::getline(flux, ligne)) {
+      size_t t1(ligne.find('\t'));
+      std::string chemin(ligne.substr(0, t1));
+      std::istringstream valeurs(ligne.substr(t1 + 1));
+      double temps(0.), compteurs[perfCounters::nbCompteurs];
+      long appels(0);
+      valeurs >> temps >> appels;
+      for (int c = 0; c < perfCounters::nbCompteurs; c++) { compteurs[c] = 0.; if (m_perfActif) valeurs >> compteurs[c]; }
+      unsigned int l(0);
+      while (l < lignes.size() && lignes[l].chemin != chemin) l++;
+      if (l == lignes.size()) {
+        size_t sep(chemin.rfind('/'));
+        if (sep != std::string::npos) {
+          std::string parent(chemin.substr(0, sep));
+          for (unsigned int k = 0; k < lignes.size(); k++) {
+            if (lignes[k].chemin == parent || lignes[k].chemin.compare(0, parent.size() + 1, parent + "/") == 0) l = k + 1;
+          }
+        }
+        Ligne nouvelle = { chemin, temps, 0., temps, 0, 0, {} };
+        lignes.insert(lignes.begin() + l, nouvelle);
+      }
+      lignes[l].min = std::min(lignes[l].min, temps);
+      lignes[l].max = std::max(lignes[l].max, temps);
+      lignes[l].somme += temps;
+      lignes[l].appels = std::max(lignes[l].appels, appels);
+      lignes[l].nbCpu++;
+      for (int c = 0; c < perfCounters::nbCompteurs; c++) { lignes[l].compteurs[c] += compteurs[c]; }
+    }
+  }
+
+  //4) Printing of the table (times in seconds, percentage of the average time of the parent region)
+  std::ios::fmtflags drapeaux(std::cout.flags());
+  std::streamsize precision(std::cout.precision());
+  std::cout << "T" << numTest << " | -------------------------------------------" << std::endl;
+  std::cout << "T" << numTest << " | WALL-CLOCK PROFILE ON " << size << " CPU(S)" << std::endl;
+  std::cout << "T" << numTest << " |     " << std::left << std::setw(36) << "Region" << std::right << std::setw(10) << "Calls"
+    << std::setw(12) << "Min (s)" << std::setw(12) << "Avg (s)" << std::setw(12) << "Max (s)" << std::setw(10) << "% parent" << std::endl;
+  double totalRacine(0.);
+  for (unsigned int l = 0; l < lignes.size(); l++) {
+    if (lignes[l].chemin.find('/') == std::string::npos) totalRacine += lignes[l].somme / size;
+  }
+  for (unsigned int l = 0; l < lignes.size(); l++) {
+    if (lignes[l].nbCpu < size) lignes[l].min = 0.;
+    double moyenne(lignes[l].somme / size);
+    //Parent average time
+    double parent(totalRacine);
+    size_t sep(lignes[l].chemin.rfind('/'));
+    std::string nom(lignes[l].chemin);
+    int profondeur(0);
+    for (size_t c = 0; c < nom.size(); c++) { if (nom[c] == '/') profondeur++; }
+    if (sep != std::string::npos) {
+      nom = lignes[l].chemin.substr(sep + 1);
+      for (unsigned int k = 0; k < l; k++) {
+        if (lignes[k].chemin == lignes[l].chemin.substr(0, sep)) { parent = lignes[k].somme / size; break; }
+      }
+    }
+    std::string affiche(std::string(2 * profondeur, ' ') + nom);
+    if (affiche.size() > 35) affiche = affiche.substr(0, 35);
+    std::cout << "T" << numTest << " |     " << std::left << std::setw(36) << affiche << std::right << std::setw(10) << lignes[l].appels
+      << std::fixed << std::setprecision(3) << std::setw(12) << lignes[l].min << std::setw(12) << moyenne << std::setw(12) << lignes[l].max
+      << std::setprecision(1) << std::setw(10) << (parent > 0. ? 100. * moyenne / parent : 0.) << std::endl;
+  }
+
+  //5) Hardware counters per region (millions of events, average over CPUs)
+  if (m_perfActif) {
+    std::cout << "T" << numTest << " | -------------------------------------------" << std::endl;
+    std::cout << "T" << numTest << " | HARDWARE COUNTERS (MILLIONS, AVERAGE OVER CPUS)" << std::endl;
+    std::cout << "T" << numTest << " |     " << std::left << std::setw(36) << "Region" << std::right;
+    for (int c = 0; c < perfCounters::nbCompteurs; c++) { std::cout << std::setw(16) << perfCounters::nom(c); }
+    std::cout << std::setw(8) << "IPC" << std::endl;
+    for (unsigned int l = 0; l < lignes.size(); l++) {
+      size_t sep(lignes[l].chemin.rfind('/'));
+      int profondeur(0);
+      for (size_t c = 0; c < lignes[l].chemin.size(); c++) { if (lignes[l].chemin[c] == '/') profondeur++; }
+      std::string affiche(std::string(2 * profondeur, ' ') + (sep != std::string::npos ? lignes[l].chemin.substr(sep + 1) : lignes[l].chemin));
+      if (affiche.size() > 35) affiche = affiche.substr(0, 35);
+      std::cout << "T" << numTest << " |     " << std::left << std::setw(36) << affiche << std::right << std::fixed << std::setprecision(3);
+      for (int c = 0; c < perfCounters::nbCompteurs; c++) {
+        if (m_perfDisponible[c]) { std::cout << std::setw(16) << lignes[l].compteurs[c] / size / 1.e6; }
+        else { std::cout << std::setw(16) << "n/a"; }
+      }
+      double ipc(lignes[l].compteurs[0] > 0. ? lignes[l].compteurs[1] / lignes[l].compteurs[0] : 0.);
+      std::cout << std::setprecision(2) << std::setw(8) << ipc << std::endl;
+    }
+  }
+  std::cout.flags(drapeaux);
+  std::cout.precision(precision);
+}
+
+//***********************************************************************
+
+double timeStats::getRegionTime(const std::string &name) const
+{
+  double temps(0.);
+  for (unsigned int r = 1; r < m_regions.size(); r++) {
+    if (m_regions[r].m_nom != name) continue;
+    //A region nested in a region of the same name (recursion over AMR levels) is already counted in it
+    bool imbriquee(false);
+    for (int parent = m_regions[r].m_parent; parent > 0; parent = m_regions[parent].m_parent) {
+      if (m_regions[parent].m_nom == name) { imbriquee = true; break; }
+    }
+    if (!imbriquee) temps += m_regions[r].m_temps;
+  }
+  return temps;
+}
+
+//***********************************************************************
+
+void timeStats::cheminRegion(const int &r, std::string &chemin) const
+{
+  std::ostringstream nom;
+  nom << m_regions[r].m_nom;
+  if (m_regions[r].m_lvl >= 0) nom << " lvl " << m_regions[r].m_lvl;
+  if (m_regions[r].m_parent > 0) {
+    this->cheminRegion(m_regions[r].m_parent, chemin);
+    chemin += "/" + nom.str();
+  }
+  else { chemin = nom.str(); }
+}
+
+//***********************************************************************
+
+double timeStats::duree(const Horloge::time_point &debut, const Horloge::time_point &fin)
+{
+  return std::chrono::duration<double>(fin - debut).count();
+}
+
+//***********************************************************************
+
+void timeStats::setCompTime(const double &compTime, const double &AMRTime, const double &comTime)
 {
   m_computationTime = compTime;
   m_AMRTime = AMRTime;
@@ -117,7 +455,7 @@ void timeStats::printScreenStats(const int &numTest) const
 
 //***********************************************************************
 
-void timeStats::printScreenTime(const clock_t &time, std::string chaine, const int &numTest) const
+void timeStats::printScreenTime(const double &time, std::string chaine, const int &numTest) const
 {
   //Managing string size
   std::string timeName(" |     " + chaine.substr(0,18));
@@ -127,7 +465,7 @@ void timeStats::printScreenTime(const clock_t &time, std::string chaine, const i
   timeName += " = ";
 
   //printing time
-  double convDouble = static_cast<double>(time) / CLOCKS_PER_SEC;
+  double convDouble = time;
   int convTime = static_cast<int>(convDouble);
   int seconde(convTime);
   if (seconde < 60)
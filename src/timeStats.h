@@ -35,9 +35,39 @@
 //! \version   1.1
 //! \date      June 5 2019
 
-#include <ctime>
+#include <chrono>
+#include <fstream>
 #include <string>
+#include <vector>
 #include <mpi.h>
+#include "perfCounters.h"
+
+typedef std::chrono::steady_clock Horloge;
+
+//! \brief     Node of the hierarchical profiler: one per (name, AMR level) and per parent region
+struct RegionProfil
+{
+  std::string m_nom;                  //!<Region name
+  int m_lvl;                          //!<AMR level of the region (-1 if not relevant)
+  int m_lvlContexte;                  //!<AMR level of the region or of its closest ancestor with a level (-1 if none)
+  int m_parent;                       //!<Index of the parent region (-1 for the root)
+  std::vector<int> m_enfants;         //!<Indexes of the nested regions
+  double m_temps;                     //!<Accumulated wall-clock time (s)
+  long m_appels;                      //!<Number of calls
+  Horloge::time_point m_debut;        //!<Wall-clock time at the opening of the current call
+  long long m_octetsDebut;            //!<Bytes sent by the halo exchanges at the opening of the current call
+  long long m_compteursDebut[perfCounters::nbCompteurs]; //!<Hardware counters at the opening of the current call
+  long long m_compteurs[perfCounters::nbCompteurs];      //!<Accumulated hardware counters
+};
+
+//! \brief     Completed region call kept in the trace buffer
+struct EvenementTrace
+{
+  int m_region;                       //!<Index of the region
+  double m_debut;                     //!<Opening time since the trace origin (microseconds)
+  double m_duree;                     //!<Duration (microseconds)
+  long long m_octets;                 //!<Bytes sent by the halo exchanges during the call
+};
 
 class timeStats
 {
@@ -51,27 +81,88 @@ class timeStats
     void startAMRTime();
     void endAMRTime();
 
-    void startCommunicationTime();
+    void startCommunicationTime(const char* region = 0, const int &lvl = -1);
     void endCommunicationTime();
 
-    void setCompTime(const clock_t &compTime, const clock_t &AMRTime, const clock_t &comTime);
-    clock_t getComputationTime() const { return m_computationTime; };
-    clock_t getAMRTime() const { return m_AMRTime; };
-    clock_t getCommunicationTime() const { return m_communicationTime; };
+    //! \brief     Open a region nested in the current one (wall-clock time)
+    //! \param     name           region name (literal string, compared to the ones of sibling regions)
+    //! \param     lvl            AMR level of the region (-1 if not relevant)
+    void startRegion(const char* name, const int &lvl = -1);
+    //! \brief     Close the current region and come back to its parent
+    void endRegion();
+    //! \brief     Return the time accumulated by the CPU in every region of the given name (all parents and levels, nested ones counted once)
+    double getRegionTime(const std::string &name) const;
+    //! \brief     Reduce region times over CPUs and print the min/avg/max table on CPU 0 (collective)
+    void printRegionsStats(const int &numTest) const;
+
+    //! \brief     Request the hardware counters per region (to be called before initializePerfCounters)
+    void configurePerfCounters(const bool &actif) { m_perfDemande = actif; };
+    //! \brief     Open the hardware counters on every CPU, disabled everywhere if not available on one CPU (collective)
+    void initializePerfCounters(const int &numTest);
+
+    //! \brief     Activate the timeline tracing (to be called before initializeTrace)
+    //! \param     capacite       number of events kept in memory before writing (0: no tracing)
+    void configureTrace(const int &capacite) { m_capaciteTrace = capacite; };
+    //! \brief     Open the trace file of the CPU and set the common time origin (collective)
+    //! \param     folder         results folder
+    //! \param     octets         cumulative counter of the bytes sent by the halo exchanges
+    void initializeTrace(const std::string &folder, const long long *octets);
+    //! \brief     Write the buffered events in the trace file of the CPU
+    void ecritTrace();
+    //! \brief     Close the trace files and merge them into a single Chrome trace file on CPU 0 (collective)
+    void termineTrace();
+
+    void setCompTime(const double &compTime, const double &AMRTime, const double &comTime);
+    double getComputationTime() const { return m_computationTime; };
+    double getAMRTime() const { return m_AMRTime; };
+    double getCommunicationTime() const { return m_communicationTime; };
     void printScreenStats(const int &numTest) const;
-    void printScreenTime(const clock_t &time, std::string chaine, const int &numTest) const;
+    void printScreenTime(const double &time, std::string chaine, const int &numTest) const;
 
   private:
-    //Time analysis - Attributes are stored in miliseconds (to be divided by CLOCKS_PER_SEC)
-    clock_t m_InitialTime;
-    clock_t m_computationTime;            //!<Computational time
+    static double duree(const Horloge::time_point &debut, const Horloge::time_point &fin);
+    void cheminRegion(const int &r, std::string &chemin) const;
+
+    //Time analysis - Attributes are wall-clock times stored in seconds
+    Horloge::time_point m_InitialTime;
+    double m_computationTime;             //!<Computational time
     
-    clock_t m_AMRRefTime;
-    clock_t m_AMRTime;                    //!<AMR time among computational time
+    Horloge::time_point m_AMRRefTime;
+    double m_AMRTime;                     //!<AMR time among computational time
+
+    Horloge::time_point m_communicationRefTime;
+    double m_communicationTime;           //!<Communication time among computational time
+    bool m_regionCommunication;           //!<A region has been opened with the current communication bracket
+
+    std::vector<RegionProfil> m_regions;  //!<Tree of the profiled regions (the root, index 0, is never closed)
+    int m_regionCourante;                 //!<Index of the current region
 
-    clock_t m_communicationRefTime;
-    clock_t m_communicationTime;          //!<Communication time among computational time
+    //Hardware counters (perf_event)
+    perfCounters m_perf;                  //!<Hardware counters of the main thread
+    bool m_perfDemande;                   //!<Hardware counters requested in the input file
+    bool m_perfActif;                     //!<Hardware counters read at each region opening and closing
+    bool m_perfDisponible[perfCounters::nbCompteurs]; //!<Counter available on every CPU
 
+    //Timeline tracing (Chrome Trace Event format)
+    int m_capaciteTrace;                  //!<Capacity of the events buffer (0: no tracing)
+    std::vector<EvenementTrace> m_evenements; //!<Events not written yet
+    Horloge::time_point m_origineTrace;   //!<Common time origin of the trace (set after a barrier)
+    const long long *m_octets;            //!<Cumulative counter of the bytes sent by the halo exchanges (may be null)
+    std::ofstream m_fichierTrace;         //!<Trace file of the CPU
+    std::string m_dossierTrace;           //!<Folder of the trace files
+    bool m_premierEvenement;              //!<No event written yet in the trace file
+
+};
+
+//! \brief     Scoped region: opened at construction, closed at destruction
+//! \details   Usage: { RegionScope region(m_stat, "flux", lvl); ... }
+class RegionScope
+{
+  public:
+    RegionScope(timeStats &stat, const char* name, const int &lvl = -1) : m_stat(stat) { m_stat.startRegion(name, lvl); };
+    ~RegionScope() { m_stat.endRegion(); };
+  private:
+    timeStats &m_stat;
 };
 
-#endif // TIMESTATS_H
\ No newline at end of file
+#endif // TIMESTATS_H
@@ -0,0 +1,460 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+//! \file      benchKernels.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+//! \brief     Microbenchmarks of the numerical kernels (Riemann solvers, EOS, relaxations, limiters, gradients)
+//! \details   Usage: benchKernels [minimal time per kernel in s (default 0.2)] [seed (default 1)]
+//!            Must be launched from the ECOGEN root folder: the EOS parameters are read from ./libEOS/.
+//!            Each kernel is called on a set of random but physically valid states: the pressures and
+//!            temperatures are drawn in fixed ranges and the densities are deduced from the EOS.
+//!            Build: make bench
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include "../src/Run.h"
+
+using namespace tinyxml2;
+
+typedef std::chrono::steady_clock Horloge;
+
+static const int numberStates(512);   //Number of random states per kernel (fit in cache)
+static double tempsMin(0.2);          //Minimal measurement time per kernel (s)
+static volatile double puits(0.);     //Results sink to keep the compiler from removing the kernels
+
+//***********************************************************************
+
+//! \brief     Time a kernel called by blocks of nbOps operations, return the time per operation (ns)
+template <typename F> double mesure(F noyau, const long long &nbOps)
+{
+  noyau(); //Warm-up
+  long long repetitions(1);
+  double duree(0.);
+  while (true) {
+    Horloge::time_point debut(Horloge::now());
+    for (long long r = 0; r < repetitions; r++) { noyau(); }
+    duree = std::chrono::duration<double>(Horloge::now() - debut).count();
+    if (duree >= tempsMin) break;
+    repetitions *= (duree > 0.01 * tempsMin) ? std::max(2LL, static_cast<long long>(1.2 * tempsMin / duree)) : 10LL;
+  }
+  return duree * 1.e9 / static_cast<double>(repetitions * nbOps);
+}
+
+//***********************************************************************
+
+//! \brief     Print a result line
+void affiche(const std::string &noyau, const double &nsParOp)
+{
+  printf("  %-58s %12.1f %12.2f\n", noyau.c_str(), nsParOp, 1.e3 / nsParOp);
+}
+
+//***********************************************************************
+
+//! \brief     Print a section header
+void afficheSection(const std::string &section)
+{
+  printf("\n%s\n  %-58s %12s %12s\n", section.c_str(), "kernel", "ns/op", "Mop/s");
+}
+
+//***********************************************************************
+
+//! \brief     Random thermodynamic states drawn in pressure and temperature ranges valid for the EOS used
+class Tirage
+{
+public:
+  Tirage(const unsigned int &seed) : m_gen(seed), m_uniforme(0., 1.) { this->plages(1.e5, 1.e8, 300., 600.); }
+  //! \brief     Pressure and temperature ranges of the next states
+  void plages(const double &pMin, const double &pMax, const double &TMin, const double &TMax) { m_pMin = pMin; m_pMax = pMax; m_TMin = TMin; m_TMax = TMax; }
+  double uniforme(const double &min, const double &max) { return min + (max - min) * m_uniforme(m_gen); }
+  double logUniforme(const double &min, const double &max) { return min * std::pow(max / min, m_uniforme(m_gen)); }
+  double pressure() { return this->logUniforme(m_pMin, m_pMax); }
+  double temperature() { return this->uniforme(m_TMin, m_TMax); }
+  double velocity() { return this->uniforme(-100., 100.); }
+  double alpha() { return this->uniforme(0.05, 0.95); }
+  double slope() { return this->uniforme(-1., 1.); }
+private:
+  std::mt19937 m_gen;
+  std::uniform_real_distribution<double> m_uniforme;
+  double m_pMin, m_pMax, m_TMin, m_TMax;
+};
+
+//***********************************************************************
+
+//! \brief     Model under benchmark with its EOS and a set of allocated and filled cells
+struct CasModel
+{
+  Model *model;
+  int numberPhases;
+  Eos **eos;
+  std::vector<Cell *> cells;
+};
+
+//***********************************************************************
+
+//! \brief     Write a random state of the initial conditions file format (initialConditionsV4.xml) for the model
+std::string etatAleatoire(const CasModel &cas, Tirage &tirage)
+{
+  const std::string &model(cas.model->whoAmI());
+  double alphas[2] = { tirage.alpha(), 0. };
+  alphas[1] = 1. - alphas[0];
+  double pMix(tirage.pressure()), TMix(tirage.temperature());
+  std::stringstream etat;
+  etat.precision(17);
+  etat << "<state name=\"bench\">";
+  for (int k = 0; k < cas.numberPhases; k++) {
+    double p(pMix), T(tirage.temperature());
+    etat << "<material type=\"fluide\" EOS=\"" << cas.eos[k]->getName() << "\"><dataFluid";
+    if (model == "EULER") {
+      etat << " density=\"" << cas.eos[k]->computeDensity(p, T) << "\" pressure=\"" << p << "\">";
+      etat << "<velocity x=\"" << tirage.velocity() << "\" y=\"" << tirage.velocity() << "\" z=\"" << tirage.velocity() << "\"/></dataFluid>";
+    }
+    else {
+      etat << " alpha=\"" << alphas[k] << "\"";
+      if (model == "KAPILA") { etat << " density=\"" << cas.eos[k]->computeDensity(p, T) << "\""; }
+      else if (model == "MULTIP") { etat << " density=\"" << cas.eos[k]->computeDensity(p, T) << "\" pressure=\"" << p << "\""; }
+      etat << "/>";
+    }
+    etat << "</material>";
+  }
+  etat << "<mixture>";
+  if (model == "KAPILA" || model == "EULERHOMOGENEOUS") { etat << "<dataMix pressure=\"" << pMix << "\"/>"; }
+  else if (model == "THERMALEQ") { etat << "<dataMix pressure=\"" << pMix << "\" temperature=\"" << TMix << "\"/>"; }
+  etat << "<velocity x=\"" << tirage.velocity() << "\" y=\"" << tirage.velocity() << "\" z=\"" << tirage.velocity() << "\"/>";
+  etat << "</mixture></state>";
+  return etat.str();
+}
+
+//***********************************************************************
+
+//! \brief     Fill a cell with a state through the same path as the initial conditions (see Input::entreeConditionsInitiales)
+void remplit(Cell *cell, const CasModel &cas, const std::string &etat)
+{
+  std::string fileName("benchKernels");
+  XMLDocument xmlEtat;
+  if (xmlEtat.Parse(etat.c_str()) != XML_SUCCESS) throw ErrorXML(fileName, __FILE__, __LINE__);
+  XMLElement *state(xmlEtat.FirstChildElement("state"));
+  const std::string &model(cas.model->whoAmI());
+
+  Mixture *stateMixture(0);
+  if (model == "EULER") { stateMixture = new MixEuler(); }
+  else if (model == "KAPILA") { stateMixture = new MixKapila(state, fileName); }
+  else if (model == "MULTIP") { stateMixture = new MixMultiP(state, fileName); }
+  else if (model == "THERMALEQ") { stateMixture = new MixThermalEq(state, fileName); }
+  else if (model == "EULERHOMOGENEOUS") { stateMixture = new MixEulerHomogeneous(state, fileName); }
+
+  std::vector<Phase*> statesPhases;
+  XMLElement *material(state->FirstChildElement("material"));
+  for (int k = 0; k < cas.numberPhases; k++) {
+    if (model == "EULER") { statesPhases.push_back(new PhaseEuler(material, cas.eos[k], fileName)); }
+    else if (model == "KAPILA") { statesPhases.push_back(new PhaseKapila(material, cas.eos[k], stateMixture->getPressure(), fileName)); }
+    else if (model == "MULTIP") { statesPhases.push_back(new PhaseMultiP(material, cas.eos[k], fileName)); }
+    else if (model == "THERMALEQ") { statesPhases.push_back(new PhaseThermalEq(material, cas.eos[k], fileName)); }
+    else if (model == "EULERHOMOGENEOUS") { statesPhases.push_back(new PhaseEulerHomogeneous(material, cas.eos[k], fileName)); }
+    material = material->NextSiblingElement("material");
+  }
+
+  std::vector<Transport> statesTransport;
+  GDEntireDomain domain("bench", statesPhases, stateMixture, statesTransport, 0);
+  domain.fillIn(cell, cas.numberPhases, 0);
+  for (int k = 0; k < cas.numberPhases; k++) { delete statesPhases[k]; }
+  delete stateMixture;
+}
+
+//***********************************************************************
+
+//! \brief     Create the model, read its EOS from the library and fill numberStates random cells
+CasModel creeCas(const std::string &model, const std::vector<std::string> &nameEOS, Tirage &tirage)
+{
+  CasModel cas;
+  cas.numberPhases = nameEOS.size();
+  int numberTransports(0);
+  if (model == "EULER") { cas.model = new ModEuler(numberTransports); }
+  else if (model == "KAPILA") { cas.model = new ModKapila(numberTransports, cas.numberPhases); }
+  else if (model == "MULTIP") { cas.model = new ModMultiP(numberTransports, cas.numberPhases); }
+  else if (model == "THERMALEQ") { cas.model = new ModThermalEq(numberTransports, cas.numberPhases); }
+  else { cas.model = new ModEulerHomogeneous(numberTransports, 0, 1); }
+
+  Input input(0);
+  int numberEos(0);
+  cas.eos = new Eos*[cas.numberPhases];
+  for (int k = 0; k < cas.numberPhases; k++) { cas.eos[k] = input.entreeEOS(nameEOS[k], numberEos); }
+  cas.eos[0]->assignEpsilonForAlphaNull(false, "benchKernels");
+
+  delete TB;
+  TB = new Tools(cas.numberPhases);
+  std::vector<AddPhys*> addPhys;
+  for (int i = 0; i < numberStates; i++) {
+    cas.cells.push_back(new Cell);
+    cas.cells[i]->allocate(cas.numberPhases, 0, addPhys, cas.model);
+    remplit(cas.cells[i], cas, etatAleatoire(cas, tirage));
+  }
+  cas.cells[0]->allocateEos(cas.numberPhases, cas.model);
+  for (int i = 0; i < numberStates; i++) { cas.cells[i]->completeFulfillState(); }
+  return cas;
+}
+
+//***********************************************************************
+
+//! \brief     Release the cells, the EOS and the model
+void detruitCas(CasModel &cas)
+{
+  for (unsigned int i = 0; i < cas.cells.size(); i++) { delete cas.cells[i]; }
+  for (int k = 0; k < cas.numberPhases; k++) { delete cas.eos[k]; }
+  delete[] cas.eos;
+  delete cas.model;
+}
+
+//***********************************************************************
+
+//! \brief     Cell to cell Riemann solvers of each model on random pairs of states
+void benchRiemann(Tirage &tirage)
+{
+  afficheSection("RIEMANN SOLVERS (solveRiemannIntern, one interface per op)");
+  std::vector< std::pair<std::string, std::vector<std::string> > > modeles;
+  modeles.push_back(std::make_pair("EULER", std::vector<std::string>(1, "IG_air.xml")));
+  std::vector<std::string> airEau; airEau.push_back("IG_air.xml"); airEau.push_back("SG_water.xml");
+  modeles.push_back(std::make_pair("KAPILA", airEau));
+  modeles.push_back(std::make_pair("MULTIP", airEau));
+  modeles.push_back(std::make_pair("THERMALEQ", airEau));
+  std::vector<std::string> liqVap; liqVap.push_back("SG_waterLiq.xml"); liqVap.push_back("IG_waterVap.xml");
+  modeles.push_back(std::make_pair("EULERHOMOGENEOUS", liqVap));
+
+  for (unsigned int m = 0; m < modeles.size(); m++) {
+    //Liquid-vapor states are drawn close to saturation
+    if (modeles[m].second == liqVap) { tirage.plages(1.e4, 1.e6, 300., 450.); }
+    else { tirage.plages(1.e5, 1.e8, 300., 600.); }
+    CasModel cas(creeCas(modeles[m].first, modeles[m].second, tirage));
+    double dx(1.e-3);
+    double ns = mesure([&]() {
+      double dtMax(1.e10);
+      for (int i = 0; i < numberStates; i++) {
+        cas.model->solveRiemannIntern(*cas.cells[i], *cas.cells[(i + 1) % numberStates], cas.numberPhases, dx, dx, dtMax);
+      }
+      puits = puits + dtMax;
+    }, numberStates);
+    std::string eos(modeles[m].second[0]);
+    for (unsigned int k = 1; k < modeles[m].second.size(); k++) { eos += "/" + modeles[m].second[k]; }
+    affiche(cas.model->whoAmI() + " (" + eos + ")", ns);
+    detruitCas(cas);
+  }
+}
+
+//***********************************************************************
+
+//! \brief     Virtual calls of the EOS on random (density, pressure) couples
+void benchEos(Tirage &tirage)
+{
+  afficheSection("EQUATIONS OF STATE (one call per op)");
+  tirage.plages(1.e5, 1.e8, 300., 600.);
+  std::vector<std::string> nameEOS;
+  nameEOS.push_back("IG_air.xml");
+  nameEOS.push_back("SG_water.xml");
+  Input input(0);
+  for (unsigned int e = 0; e < nameEOS.size(); e++) {
+    int numberEos(0);
+    Eos *eos(input.entreeEOS(nameEOS[e], numberEos));
+    std::vector<double> p(numberStates), T(numberStates), rho(numberStates), energie(numberStates);
+    for (int i = 0; i < numberStates; i++) {
+      p[i] = tirage.pressure(); T[i] = tirage.temperature();
+      rho[i] = eos->computeDensity(p[i], T[i]);
+      energie[i] = eos->computeEnergy(rho[i], p[i]);
+    }
+    std::string type(nameEOS[e].substr(0, 2) == "IG" ? "EosIG" : "EosSG");
+    type += " (" + nameEOS[e] + ")::";
+    double somme(0.);
+    affiche(type + "computeTemperature", mesure([&]() { for (int i = 0; i < numberStates; i++) { somme += eos->computeTemperature(rho[i], p[i]); } }, numberStates));
+    affiche(type + "computeEnergy", mesure([&]() { for (int i = 0; i < numberStates; i++) { somme += eos->computeEnergy(rho[i], p[i]); } }, numberStates));
+    affiche(type + "computePressure", mesure([&]() { for (int i = 0; i < numberStates; i++) { somme += eos->computePressure(rho[i], energie[i]); } }, numberStates));
+    affiche(type + "computeDensity", mesure([&]() { for (int i = 0; i < numberStates; i++) { somme += eos->computeDensity(p[i], T[i]); } }, numberStates));
+    affiche(type + "computeSoundSpeed", mesure([&]() { for (int i = 0; i < numberStates; i++) { somme += eos->computeSoundSpeed(rho[i], p[i]); } }, numberStates));
+    puits = puits + somme;
+    delete eos;
+  }
+}
+
+//***********************************************************************
+
+//! \brief     Stiff relaxations on random out of equilibrium Kapila states
+//! \details   The cells are restored from a copy before each relaxation; the cost of the copy is measured apart and subtracted.
+void benchRelaxations(Tirage &tirage)
+{
+  afficheSection("RELAXATIONS (stiffRelaxation, one cell per op, state reset subtracted)");
+  std::vector<std::string> airEau; airEau.push_back("IG_air.xml"); airEau.push_back("SG_water.xml");
+  std::vector<std::string> liqVap; liqVap.push_back("SG_waterLiq.xml"); liqVap.push_back("IG_waterVap.xml");
+
+  XMLDocument xmlRelaxation;
+  xmlRelaxation.Parse("<relaxation type=\"PTMu\"><dataPTMu liquid=\"SG_waterLiq.xml\" vapor=\"IG_waterVap.xml\"/></relaxation>");
+  std::vector<Relaxation *> relaxations;
+  relaxations.push_back(new RelaxationP());
+  relaxations.push_back(new RelaxationPT());
+  relaxations.push_back(new RelaxationPTMu(xmlRelaxation.FirstChildElement("relaxation"), "benchKernels"));
+  const char *names[3] = { "RelaxationP (IG_air.xml/SG_water.xml)", "RelaxationPT (IG_air.xml/SG_water.xml)", "RelaxationPTMu (SG_waterLiq.xml/IG_waterVap.xml)" };
+
+  for (unsigned int r = 0; r < relaxations.size(); r++) {
+    if (r < 2) { tirage.plages(1.e5, 1.e8, 300., 600.); }
+    else { tirage.plages(1.e4, 1.e6, 300., 450.); }
+    CasModel cas(creeCas("KAPILA", (r < 2) ? airEau : liqVap, tirage));
+    //Pressure disequilibrium (the densities drawn from different temperatures already give a thermal disequilibrium)
+    for (int i = 0; i < numberStates; i++) {
+      for (int k = 0; k < cas.numberPhases; k++) { cas.cells[i]->getPhase(k)->setPressure(cas.cells[i]->getPhase(k)->getPressure() * tirage.uniforme(0.7, 1.3)); }
+      cas.cells[i]->fulfillState();
+    }
+    std::vector<Cell *> copies;
+    std::vector<AddPhys*> addPhys;
+    for (int i = 0; i < numberStates; i++) {
+      copies.push_back(new Cell);
+      copies[i]->allocate(cas.numberPhases, 0, addPhys, cas.model);
+    }
+    for (int i = 0; i < numberStates; i++) {
+      for (int k = 0; k < cas.numberPhases; k++) { copies[i]->copyPhase(k, cas.cells[i]->getPhase(k)); }
+      copies[i]->copyMixture(cas.cells[i]->getMixture());
+    }
+    auto restaure = [&](const int &i) {
+      for (int k = 0; k < cas.numberPhases; k++) { cas.cells[i]->copyPhase(k, copies[i]->getPhase(k)); }
+      cas.cells[i]->copyMixture(copies[i]->getMixture());
+    };
+    double nsCopie = mesure([&]() { for (int i = 0; i < numberStates; i++) { restaure(i); } }, numberStates);
+    double ns = mesure([&]() {
+      for (int i = 0; i < numberStates; i++) {
+        restaure(i);
+        relaxations[r]->stiffRelaxation(cas.cells[i], cas.numberPhases);
+      }
+      puits = puits + cas.cells[0]->getPhase(0)->getPressure();
+    }, numberStates);
+    affiche(names[r], std::max(ns - nsCopie, 1.e-3));
+    if (errors.size() != 0) {
+      printf("  (%d relaxation errors reported on the random states)\n", static_cast<int>(errors.size()));
+      errors.clear();
+    }
+    for (int i = 0; i < numberStates; i++) { delete copies[i]; }
+    detruitCas(cas);
+  }
+  for (unsigned int r = 0; r < relaxations.size(); r++) { delete relaxations[r]; }
+}
+
+//***********************************************************************
+
+//! \brief     Slope limiters on random couples of slopes
+void benchLimiters(Tirage &tirage)
+{
+  afficheSection("LIMITERS (limiteSlope, one couple of slopes per op)");
+  std::vector<Limiter *> limiters;
+  limiters.push_back(new LimiterMinmod());
+  limiters.push_back(new LimiterVanLeer());
+  limiters.push_back(new LimiterVanAlbada());
+  limiters.push_back(new LimiterMC());
+  limiters.push_back(new LimiterSuperBee());
+  limiters.push_back(new LimiterTHINC());
+  const char *names[6] = { "LimiterMinmod", "LimiterVanLeer", "LimiterVanAlbada", "LimiterMC", "LimiterSuperBee", "LimiterTHINC" };
+  std::vector<double> slopes1(numberStates), slopes2(numberStates);
+  for (int i = 0; i < numberStates; i++) { slopes1[i] = tirage.slope(); slopes2[i] = tirage.slope(); }
+  for (unsigned int l = 0; l < limiters.size(); l++) {
+    double somme(0.);
+    affiche(names[l], mesure([&]() { for (int i = 0; i < numberStates; i++) { somme += limiters[l]->limiteSlope(slopes1[i], slopes2[i]); } }, numberStates));
+    puits = puits + somme;
+    delete limiters[l];
+  }
+}
+
+//***********************************************************************
+
+//! \brief     Cell gradients on a 2D Cartesian mesh of random Euler states (absorbing boundaries)
+void benchGradients(Tirage &tirage)
+{
+  afficheSection("GRADIENTS (Cell::computeGradient, one cell per op, 2D Cartesian 64x64)");
+  tirage.plages(1.e5, 1.e8, 300., 600.);
+  CasModel cas(creeCas("EULER", std::vector<std::string>(1, "IG_air.xml"), tirage));
+  std::vector<stretchZone> stretch;
+  MeshCartesian mesh(1., 64, 1., 64, 1., 1, stretch, stretch, stretch);
+  std::vector<BoundCond*> boundCond;
+  mesh.attributLimites(boundCond);
+  TypeMeshContainer<Cell *> cells, cellsGhost;
+  TypeMeshContainer<CellInterface *> cellInterfaces;
+  mesh.initializeGeometrie(cells, cellsGhost, cellInterfaces, 0, false, "FIRSTORDER");
+  std::vector<AddPhys*> addPhys;
+  for (unsigned int i = 0; i < cells.size(); i++) {
+    cells[i]->allocate(cas.numberPhases, 0, addPhys, cas.model);
+    remplit(cells[i], cas, etatAleatoire(cas, tirage));
+    cells[i]->completeFulfillState();
+  }
+  int nbCells(cells.size());
+
+  Coord somme(0.);
+  affiche("computeGradient(density)", mesure([&]() { for (int i = 0; i < nbCells; i++) { somme += cells[i]->computeGradient(density, 0); } }, nbCells));
+  std::vector<Variable> variables; variables.push_back(density); variables.push_back(pressure); variables.push_back(velocityU); variables.push_back(velocityV);
+  std::vector<int> numPhases(variables.size(), 0);
+  std::vector<Coord> grads(variables.size());
+  affiche("computeGradient(density, pressure, velocityU, velocityV)", mesure([&]() {
+    for (int i = 0; i < nbCells; i++) { cells[i]->computeGradient(grads, variables, numPhases); somme += grads[0]; }
+  }, nbCells));
+  puits = puits + somme.norm();
+
+  for (unsigned int i = 0; i < cells.size(); i++) { delete cells[i]; }
+  for (unsigned int i = 0; i < cellInterfaces.size(); i++) { delete cellInterfaces[i]; }
+  detruitCas(cas);
+}
+
+//***********************************************************************
+
+int main(int argc, char *argv[])
+{
+  MPI_Init(&argc, &argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rankCpu);
+  MPI_Comm_size(MPI_COMM_WORLD, &Ncpu);
+  if (argc > 1) { tempsMin = atof(argv[1]); }
+  unsigned int seed = (argc > 2) ? static_cast<unsigned int>(atoi(argv[2])) : 1;
+  if (argc > 3 || tempsMin <= 0.) {
+    std::cerr << "Usage: " << argv[0] << " [minimal time per kernel in s (default 0.2)] [seed (default 1)]" << std::endl;
+    MPI_Finalize();
+    return EXIT_FAILURE;
+  }
+
+  printf("ECOGEN kernel microbenchmarks: %d random states per kernel, at least %g s per kernel, seed %u\n", numberStates, tempsMin, seed);
+  Tirage tirage(seed);
+  try {
+    benchRiemann(tirage);
+    benchEos(tirage);
+    benchRelaxations(tirage);
+    benchLimiters(tirage);
+    benchGradients(tirage);
+  }
+  catch (ErrorECOGEN &e) {
+    std::cerr << e.infoError() << std::endl;
+    MPI_Finalize();
+    return EXIT_FAILURE;
+  }
+  delete TB;
+  MPI_Finalize();
+  return 0;
+}
@@ -0,0 +1,164 @@
+//  
+//       ,---.     ,--,    .---.     ,--,    ,---.    .-. .-. 
+//       | .-'   .' .')   / .-. )  .' .'     | .-'    |  \| | 
+//       | `-.   |  |(_)  | | |(_) |  |  __  | `-.    |   | | 
+//       | .-'   \  \     | | | |  \  \ ( _) | .-'    | |\  | 
+//       |  `--.  \  `-.  \ `-' /   \  `-) ) |  `--.  | | |)| 
+//       /( __.'   \____\  )---'    )\____/  /( __.'  /(  (_) 
+//      (__)              (_)      (__)     (__)     (__)     
+//
+//  This file is part of ECOGEN.
+//
+//  ECOGEN is the legal property of its developers, whose names 
+//  are listed in the copyright file included with this source 
+//  distribution.
+//
+//  ECOGEN is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published 
+//  by the Free Software Foundation, either version 3 of the License, 
+//  or (at your option) any later version.
+//  
+//  ECOGEN is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with ECOGEN (file LICENSE).  
+//  If not, see <http://www.gnu.org/licenses/>.
+
+
+//! \file      probeArrayReader.cpp
+//! \author    F. Petitpas, K. Schmidmayer
+//! \version   1.0
+//! \date      October 18 2026
+//! \brief     Reader of the probe array files (see src/InputOutput/OutputProbeArray.h)
+//! \details   Usage: probeArrayReader <probes folder>/<probe array name>            list the points and the columns
+//!                   probeArrayReader <probes folder>/<probe array name> <index>    print the time series of a point (gnuplot format)
+//!            The files <name>_CPU0.bin, <name>_CPU1.bin... are read until one is missing.
+//!            Build: make probeArrayReader
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+struct Point
+{
+  double x, y, z;
+  int cpu;
+};
+
+//! \brief     Read a value, exit with a message if the file is truncated
+template <typename T> void lit(std::ifstream &fichier, T *valeurs, size_t nombre, const std::string &name)
+{
+  fichier.read(reinterpret_cast<char *>(valeurs), nombre * sizeof(T));
+  if (!fichier) { std::cerr << "Truncated file " << name << std::endl; exit(EXIT_FAILURE); }
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2 || argc > 3) {
+    std::cerr << "Usage: " << argv[0] << " <probes folder>/<probe array name> [point index]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::string prefix(argv[1]);
+  int index = (argc == 3) ? atoi(argv[2]) : -1;
+
+  std::map<int, Point> points;                                  //Every point found, by index
+  std::vector<std::string> colonnes;                            //Names of the columns
+  std::vector< std::pair<double, std::vector<double> > > serie; //Samples of the requested point
+
+  int nbFichiers(0);
+  for (int cpu = 0; ; cpu++) {
+    std::stringstream name;
+    name << prefix << "_CPU" << cpu << ".bin";
+    std::ifstream fichier(name.str().c_str(), std::ios::binary);
+    if (!fichier) break;
+    nbFichiers++;
+
+    char magic[8];
+    int32_t version;
+    lit(fichier, magic, 8, name.str());
+    lit(fichier, &version, 1, name.str());
+    if (std::strncmp(magic, "ECOGENPA", 8) != 0 || version != 1) { std::cerr << "Unknown format: " << name.str() << std::endl; return EXIT_FAILURE; }
+
+    //Current layout of the file
+    std::vector<int32_t> indices;
+    int32_t nbColonnes(0), position(-1);
+    std::vector<double> echantillon;
+    int32_t type;
+    while (fichier.read(reinterpret_cast<char *>(&type), sizeof(type))) {
+      if (type == 1) { //Layout
+        int32_t nbPoints;
+        lit(fichier, &nbPoints, 1, name.str());
+        lit(fichier, &nbColonnes, 1, name.str());
+        indices.resize(nbPoints);
+        position = -1;
+        for (int p = 0; p < nbPoints; p++) {
+          double xyz[3];
+          lit(fichier, &indices[p], 1, name.str());
+          lit(fichier, xyz, 3, name.str());
+          Point point = { xyz[0], xyz[1], xyz[2], cpu };
+          points[indices[p]] = point;
+          if (indices[p] == index) position = p;
+        }
+        colonnes.resize(nbColonnes);
+        for (int c = 0; c < nbColonnes; c++) {
+          int32_t taille;
+          lit(fichier, &taille, 1, name.str());
+          colonnes[c].resize(taille);
+          if (taille > 0) lit(fichier, &colonnes[c][0], taille, name.str());
+        }
+      }
+      else if (type == 2) { //Samples
+        int32_t nbEchantillons;
+        lit(fichier, &nbEchantillons, 1, name.str());
+        echantillon.resize(1 + indices.size() * nbColonnes);
+        for (int e = 0; e < nbEchantillons; e++) {
+          lit(fichier, &echantillon[0], echantillon.size(), name.str());
+          if (position >= 0) {
+            serie.push_back(std::make_pair(echantillon[0], std::vector<double>(echantillon.begin() + 1 + position * nbColonnes, echantillon.begin() + 1 + (position + 1) * nbColonnes)));
+          }
+        }
+      }
+      else { std::cerr << "Unknown block type " << type << " in " << name.str() << std::endl; return EXIT_FAILURE; }
+    }
+  }
+  if (nbFichiers == 0) { std::cerr << "No file " << prefix << "_CPU0.bin" << std::endl; return EXIT_FAILURE; }
+
+  std::cout.precision(12);
+  if (index < 0) {
+    //List of the points and of the columns
+    std::cout << "# " << points.size() << " points (index x y z CPU of the last record)" << std::endl;
+    for (std::map<int, Point>::const_iterator it = points.begin(); it != points.end(); ++it) {
+      std::cout << it->first << " " << it->second.x << " " << it->second.y << " " << it->second.z << " " << it->second.cpu << std::endl;
+    }
+    std::cout << "# " << colonnes.size() << " columns:";
+    for (unsigned int c = 0; c < colonnes.size(); c++) std::cout << " " << colonnes[c];
+    std::cout << std::endl;
+  }
+  else {
+    if (points.find(index) == points.end()) { std::cerr << "No point " << index << std::endl; return EXIT_FAILURE; }
+    //Samples from several CPU (load balancing) are put back in time order
+    std::stable_sort(serie.begin(), serie.end(),
+      [](const std::pair<double, std::vector<double> > &a, const std::pair<double, std::vector<double> > &b) { return a.first < b.first; });
+    const Point &point = points[index];
+    std::cout << "# point " << index << " (" << point.x << ", " << point.y << ", " << point.z << ")" << std::endl;
+    std::cout << "# time";
+    for (unsigned int c = 0; c < colonnes.size(); c++) std::cout << " " << colonnes[c];
+    std::cout << std::endl;
+    for (unsigned int e = 0; e < serie.size(); e++) {
+      std::cout << serie[e].first;
+      for (unsigned int c = 0; c < serie[e].second.size(); c++) std::cout << " " << serie[e].second[c];
+      std::cout << std::endl;
+    }
+  }
+  return EXIT_SUCCESS;
+}